@@ -2,6 +2,12 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <array>
+#include <utility>
+#include <chrono>
+#include <random>
+
+#include "montgomery.hpp"
 
 template<typename T>
 T pow_recursive(const T& base, unsigned int exp) {
@@ -25,6 +31,100 @@ T pow_iterative(T base, unsigned int exp) {
   return res;
 }
 
+// Knuth's power tree: a tree with root 1 where the path from the root to n is an
+// addition chain for n, i.e. 1 = c_0 < c_1 < ... < c_r = n where every c_(i+1) is
+// c_i plus some earlier c_j. Then x^n is computed with r multiplications
+// x^(c_(i+1)) = x^(c_i) * x^(c_j), which is optimal or close to optimal (e.g. x^15 needs
+// 5 multiplications instead of the 6 of binary squaring).
+// The tree is built level by level: the children of n are n + c_0, n + c_1, ..., n + n
+// (the elements of its path) that are not already in the tree.
+constexpr unsigned int POWER_TREE_SIZE = 256;
+
+constexpr auto build_power_tree() {
+  // parent[n] == 0 means that n is not in the tree yet
+  std::array<unsigned int, POWER_TREE_SIZE + 1> parent{};
+  std::array<unsigned int, POWER_TREE_SIZE + 1> queue{};
+  std::array<unsigned int, POWER_TREE_SIZE + 1> path{};
+  std::size_t head = 0, tail = 0;
+  queue[tail++] = 1;
+  parent[1] = 1;
+  while (head < tail) {
+    const auto n = queue[head++];
+    // path from n to the root
+    std::size_t len = 0;
+    for (auto k = n; k != 1; k = parent[k])
+      path[len++] = k;
+    path[len++] = 1;
+    // the children are added in the order of the path from the root
+    while (len-- > 0) {
+      const auto child = n + path[len];
+      if (child <= POWER_TREE_SIZE && parent[child] == 0) {
+        parent[child] = n;
+        queue[tail++] = child;
+      }
+    }
+  }
+  return parent;
+}
+
+constexpr auto POWER_TREE = build_power_tree();
+
+// number of multiplications of the chain for n
+constexpr std::size_t chain_length(unsigned int n) {
+  std::size_t len = 0;
+  for (; n > 1; n = POWER_TREE[n])
+    ++len;
+  return len;
+}
+
+// step i of the chain computes x^(c_(i+1)) = x^(c_i) * x^(c_j), we store j
+template<unsigned int N>
+constexpr auto addition_chain() {
+  static_assert(N >= 1 && N <= POWER_TREE_SIZE, "exponent out of the power tree");
+  constexpr auto L = chain_length(N);
+  std::array<unsigned int, L + 1> c{};
+  c[L] = N;
+  for (auto i = L; i > 0; --i)
+    c[i - 1] = POWER_TREE[c[i]];
+  std::array<std::size_t, L> steps{};
+  for (std::size_t i = 0; i < L; ++i)
+    for (std::size_t j = 0; j <= i; ++j)
+      if (c[j] == c[i + 1] - c[i])
+        steps[i] = j;
+  return steps;
+}
+
+// x^N with the multiplications of the addition chain for N, the fold expression is
+// expanded at compile time into a straight-line sequence without loops or branches
+template<unsigned int N, typename T>
+constexpr T pow(const T& x) {
+  if constexpr (N == 0) {
+    return 1;
+  }
+  else {
+    constexpr auto steps = addition_chain<N>();
+    std::array<T, steps.size() + 1> v{};
+    v[0] = x;
+    [&] <std::size_t... I>(std::index_sequence<I...>) {
+      ((v[I + 1] = v[I] * v[steps[I]]), ...);
+    }(std::make_index_sequence<steps.size()>{});
+    return v.back();
+  }
+}
+
+// the exponents smaller than this are dispatched to pow<N>
+constexpr unsigned int POW_TABLE_SIZE = 64;
+
+// x^exp with exp known only at runtime: small exponents use a table of pow<N>,
+// the others fall back to exponentiation by squaring
+template<typename T>
+T pow_dispatch(const T& x, unsigned int exp) {
+  static constexpr auto table = []<std::size_t... N>(std::index_sequence<N...>) {
+    return std::array<T(*)(const T&), sizeof...(N)>{ &pow<N, T>... };
+  }(std::make_index_sequence<POW_TABLE_SIZE>{});
+  return exp < table.size() ? table[exp](x) : pow_iterative(x, exp);
+}
+
 double rel_error(double a, double b) {
   if (a == 0 && b == 0)
     return 0;
@@ -55,8 +155,89 @@ int main() {
     for (const auto& b : base_double) {
       test_error(rel_error(pow_recursive(b, e), std::pow(b, e)), TOLL);
       test_error(rel_error(pow_iterative(b, e), std::pow(b, e)), TOLL);
+      test_error(rel_error(pow_dispatch(b, e), std::pow(b, e)), TOLL);
     }
   }
 
+  std::cout << "-- addition chain tests -----------------" << std::endl;
+  // the exponents of pow<N> must be known at compile time
+  [&] <unsigned int... E>(std::integer_sequence<unsigned int, E...>) {
+    for (const auto& b : base_double)
+      (test_error(rel_error(pow<E>(b), std::pow(b, E)), TOLL), ...);
+  }(std::integer_sequence<unsigned int, 0, 1, 2, 3, 5, 7, 8, 13, 15, 31, 63>{});
+  std::cout << "multiplications for x^15: " << chain_length(15)
+    << ", x^63: " << chain_length(63) << ", x^255: " << chain_length(255) << std::endl;
+
+  std::cout << "-- benchmark x^13 -----------------" << std::endl;
+  std::vector<double> x(10000000);
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<double> distrib(0.5, 1.5);
+  for (auto& v : x)
+    v = distrib(engine);
+  const auto benchmark = [&x](const std::string& name, const auto& f) {
+    using namespace std::chrono;
+    double sum = 0;
+    const auto t0 = high_resolution_clock::now();
+    for (const auto& v : x)
+      sum += f(v);
+    const auto t1 = high_resolution_clock::now();
+    // printing the sum prevents the compiler from removing the loop
+    std::cout << name << ": " << duration_cast<milliseconds>(t1 - t0).count() << " [ms] (sum " << sum << ")" << std::endl;
+  };
+  benchmark("std::pow", [](double v) { return std::pow(v, 13); });
+  benchmark("pow_iterative", [](double v) { return pow_iterative(v, 13); });
+  benchmark("pow<13>", [](double v) { return pow<13>(v); });
+  benchmark("pow_dispatch", [](double v) { return pow_dispatch(v, 13); });
+
+  std::cout << "-- modular tests -----------------" << std::endl;
+  std::uniform_int_distribution<uint64_t> distrib_u64;
+  std::vector<uint64_t> bases(1000000), out;
+  for (auto& b : bases)
+    b = distrib_u64(engine);
+  bool equal = true;
+  // odd moduli of every size, up to the largest 64-bit prime 2^64 - 59
+  for (const uint64_t m : { 3ull, 1000003ull, (1ull << 61) - 1, 18446744073709551557ull }) {
+    const Montgomery mont(m);
+    for (unsigned int k = 0; k < 1000; ++k) {
+      const auto e = bases[k + 1] >> (k % 64);
+      equal = equal && mont.pow(bases[k], e) == pow_mod_naive(bases[k], e, m);
+    }
+  }
+  std::cout << "montgomery pow " << (equal ? "PASSED" : "FAIL") << std::endl;
+  // 3215031751 is a strong pseudoprime to bases 2, 3, 5, 7 and 561 is a Carmichael number
+  const bool primes_ok = is_prime(2) && is_prime(1000003) && is_prime((1ull << 61) - 1)
+    && is_prime(18446744073709551557ull) && !is_prime(1) && !is_prime(561)
+    && !is_prime(3215031751ull) && !is_prime(1000003ull * 1000033ull);
+  unsigned int n_primes = 0;
+  for (uint64_t n = 0; n < 100000; ++n)
+    n_primes += is_prime(n);
+  std::cout << "is_prime " << (primes_ok && n_primes == 9592 ? "PASSED" : "FAIL") << std::endl;
+
+  std::cout << "-- benchmark modpow -----------------" << std::endl;
+  {
+    using namespace std::chrono;
+    const uint64_t m = 18446744073709551557ull, e = m - 2;
+    const Montgomery mont(m);
+    uint64_t sum = 0;
+    auto t0 = high_resolution_clock::now();
+    for (const auto& b : bases)
+      sum += pow_mod_naive(b, e, m);
+    auto t1 = high_resolution_clock::now();
+    std::cout << "naive: " << duration_cast<milliseconds>(t1 - t0).count() << " [ms] (sum " << sum << ")" << std::endl;
+    sum = 0;
+    t0 = high_resolution_clock::now();
+    for (const auto& b : bases)
+      sum += mont.pow(b, e);
+    t1 = high_resolution_clock::now();
+    std::cout << "montgomery: " << duration_cast<milliseconds>(t1 - t0).count() << " [ms] (sum " << sum << ")" << std::endl;
+    sum = 0;
+    t0 = high_resolution_clock::now();
+    mont.pow_many(bases, e, out);
+    for (const auto& o : out)
+      sum += o;
+    t1 = high_resolution_clock::now();
+    std::cout << "montgomery batched: " << duration_cast<milliseconds>(t1 - t0).count() << " [ms] (sum " << sum << ")" << std::endl;
+  }
+
   return 0;
 }
\ No newline at end of file
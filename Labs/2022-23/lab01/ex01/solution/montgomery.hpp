@@ -0,0 +1,145 @@
+#ifndef MONTGOMERY_H
+#define MONTGOMERY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <cassert>
+
+// 128-bit integers are a GCC/Clang extension, __extension__ keeps -pedantic quiet
+__extension__ using u128 = unsigned __int128;
+
+// base^exp mod m reducing with % after every multiplication, the 128-bit
+// remainder is a call to a slow library routine
+inline uint64_t pow_mod_naive(uint64_t base, uint64_t exp, uint64_t m) {
+  uint64_t res = 1 % m;
+  base %= m;
+  while (exp > 0) {
+    if (exp & 1)
+      res = static_cast<u128>(res) * base % m;
+    base = static_cast<u128>(base) * base % m;
+    exp >>= 1;
+  }
+  return res;
+}
+
+// Montgomery arithmetic modulo an odd m < 2^64 with R = 2^64: x is stored as
+// x R mod m, so that the product of a R and b R can be reduced by R with two
+// multiplications and a subtraction (REDC) instead of a division by m
+class Montgomery {
+public:
+  explicit Montgomery(uint64_t m) : m_mod(m) {
+    assert(m & 1);
+    // m^-1 mod 2^64 with Newton's iteration, every step doubles the correct bits
+    // (m is its own inverse mod 8, so we start with 3 bits)
+    m_inv = m;
+    for (int i = 0; i < 5; ++i)
+      m_inv *= 2 - m * m_inv;
+    m_one = -m % m;
+    m_r2 = static_cast<u128>(m_one) * m_one % m;
+  }
+
+  uint64_t mod() const { return m_mod; }
+
+  // T R^-1 mod m for T < m 2^64: q = T m^-1 mod 2^64 makes T - q m divisible by 2^64,
+  // the low halves cancel out so only the high halves are subtracted
+  uint64_t reduce(u128 t) const {
+    const uint64_t q = static_cast<uint64_t>(t) * m_inv;
+    const uint64_t hi = t >> 64;
+    const uint64_t qm_hi = (static_cast<u128>(q) * m_mod) >> 64;
+    return hi >= qm_hi ? hi - qm_hi : hi - qm_hi + m_mod;
+  }
+
+  uint64_t mul(uint64_t a, uint64_t b) const { return reduce(static_cast<u128>(a) * b); }
+  uint64_t to_montgomery(uint64_t x) const { return mul(x % m_mod, m_r2); }
+  uint64_t from_montgomery(uint64_t x) const { return reduce(x); }
+
+  // base^exp mod m, base and result in the usual representation
+  uint64_t pow(uint64_t base, uint64_t exp) const {
+    uint64_t b = to_montgomery(base), res = m_one;
+    while (exp > 0) {
+      if (exp & 1)
+        res = mul(res, b);
+      b = mul(b, b);
+      exp >>= 1;
+    }
+    return from_montgomery(res);
+  }
+
+  // out[i] = bases[i]^exp mod m. The chain of multiplications of a single base is
+  // sequential, here `lanes` bases go through the same bit together so their
+  // multiplications are independent and overlap in the pipeline
+  void pow_many(const uint64_t* bases, std::size_t n, uint64_t exp, uint64_t* out) const {
+    constexpr std::size_t lanes = 4;
+    const auto n_full = n - n % lanes;
+    for (std::size_t i = 0; i < n_full; i += lanes) {
+      std::array<uint64_t, lanes> b, res;
+      for (std::size_t l = 0; l < lanes; ++l) {
+        b[l] = to_montgomery(bases[i + l]);
+        res[l] = m_one;
+      }
+      for (auto e = exp; e > 0; e >>= 1) {
+        if (e & 1)
+          for (std::size_t l = 0; l < lanes; ++l)
+            res[l] = mul(res[l], b[l]);
+        for (std::size_t l = 0; l < lanes; ++l)
+          b[l] = mul(b[l], b[l]);
+      }
+      for (std::size_t l = 0; l < lanes; ++l)
+        out[i + l] = from_montgomery(res[l]);
+    }
+    for (auto i = n_full; i < n; ++i)
+      out[i] = pow(bases[i], exp);
+  }
+
+  void pow_many(const std::vector<uint64_t>& bases, uint64_t exp, std::vector<uint64_t>& out) const {
+    out.resize(bases.size());
+    pow_many(bases.data(), bases.size(), exp, out.data());
+  }
+
+private:
+  uint64_t m_mod;
+  // m^-1 mod 2^64
+  uint64_t m_inv;
+  // R mod m and R^2 mod m
+  uint64_t m_one;
+  uint64_t m_r2;
+};
+
+// deterministic Miller-Rabin test: the first 12 primes as witnesses are enough
+// for every n < 3.3 10^24, so for all 64-bit integers
+inline bool is_prime(uint64_t n) {
+  constexpr std::array<uint64_t, 12> witnesses = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+  if (n < 2)
+    return false;
+  for (const auto p : witnesses) {
+    if (n % p == 0)
+      return n == p;
+  }
+  // n - 1 = d 2^s with d odd
+  auto d = n - 1;
+  int s = 0;
+  for (; (d & 1) == 0; d >>= 1)
+    ++s;
+  const Montgomery mont(n);
+  std::array<uint64_t, witnesses.size()> x;
+  mont.pow_many(witnesses.data(), witnesses.size(), d, x.data());
+  for (auto y : x) {
+    if (y == 1 || y == n - 1)
+      continue;
+    // n is composite unless one of y^2, y^4, ..., y^(2^(s-1)) is -1
+    bool composite = true;
+    y = mont.to_montgomery(y);
+    const auto minus_one = mont.to_montgomery(n - 1);
+    for (int r = 1; r < s && composite; ++r) {
+      y = mont.mul(y, y);
+      composite = y != minus_one;
+    }
+    if (composite)
+      return false;
+  }
+  return true;
+}
+
+#endif /* MONTGOMERY_H */
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <string>
+#include <ranges>
+#include <algorithm>
+#include <limits>
+
+#include "horner.hpp"
+#include "aberth.hpp"
+
+// utility for printing the result of a test
+void print_test_result(bool r, const std::string& test_name) {
+    std::cout << test_name << " test: " << (r ? "PASSED" : "FAILED") << std::endl;
+}
+
+// max over the roots of the backward error |p(z)| / sum |a_k| |z|^k, i.e. the smallest
+// relative perturbation of the coefficients for which z is an exact root.
+// For |z| > 1 both the sums are divided by |z|^n
+double backward_error(const std::vector<double>& a, const std::vector<complex_t>& roots) {
+    double error = 0.0;
+    for (const auto z : roots) {
+        const bool reversed = std::abs(z) > 1;
+        const auto w = reversed ? 1.0 / z : z;
+        complex_t p = 0;
+        double scale = 0;
+        for (std::size_t k = 0; k < a.size(); ++k) {
+            const auto c = reversed ? a[k] : a[a.size() - 1 - k];
+            p = p * w + c;
+            scale = scale * std::abs(w) + std::abs(c);
+        }
+        error = std::max(error, std::abs(p) / scale);
+    }
+    return error;
+}
+
+// tests and benchmark of the Aberth-Ehrlich method, on polynomials with coefficients
+// 2 sin(2k) of degree from 100 to the value given as first argument
+int main(int argc, char* argv[]) {
+    const unsigned int max_degree = argc > 1 ? std::stoul(argv[1]) : 10000;
+    ThreadPool pool;
+
+    std::cout << "-- tests --------------------------" << std::endl;
+    {
+        // x^n - 1, the roots of unity
+        const unsigned int n = 64;
+        std::vector<double> a(n + 1, 0.0);
+        a[0] = -1.0;
+        a[n] = 1.0;
+        const auto result = aberth_roots(a, pool);
+        double error = 0.0;
+        for (unsigned int k = 0; k < n; ++k) {
+            const auto root = std::polar(1.0, 2 * std::numbers::pi * k / n);
+            double dist = std::numeric_limits<double>::infinity();
+            for (const auto z : result.roots)
+                dist = std::min(dist, std::abs(z - root));
+            error = std::max(error, dist);
+        }
+        print_test_result(result.converged && error < 1e-13, "roots of unity");
+
+        // (x - 1)(x - 2)(x - 3)(x + 0.5) with a zero leading coefficient
+        const auto real = aberth_roots({ -3.0, -0.5, 8.0, -5.5, 1.0, 0.0 }, pool);
+        std::vector<double> re;
+        for (const auto z : real.roots)
+            re.push_back(z.real());
+        std::ranges::sort(re);
+        const std::vector<double> ref{ -0.5, 1.0, 2.0, 3.0 };
+        error = 0.0;
+        for (std::size_t k = 0; k < ref.size(); ++k)
+            error = std::max(error, std::abs(re[k] - ref[k]));
+        for (const auto z : real.roots)
+            error = std::max(error, std::abs(z.imag()));
+        print_test_result(real.roots.size() == 4 && error < 1e-13, "real roots");
+
+        // x (x^2 + 1), a root at the origin
+        const auto zero = aberth_roots({ 0.0, 1.0, 0.0, 1.0 }, pool);
+        print_test_result(zero.converged && backward_error({ 0.0, 1.0, 0.0, 1.0 }, zero.roots) < 1e-15, "root at zero");
+    }
+
+    std::cout << "-- benchmark (" << pool.size() << " threads) --" << std::endl;
+    std::cout << std::setw(10) << "degree" << std::setw(10) << "sweeps"
+        << std::setw(14) << "time [ms]" << std::setw(16) << "backward error" << std::endl;
+    for (unsigned int degree = 100; degree <= max_degree; degree *= 10) {
+        const auto coeff_range = std::views::iota(0u, degree + 1) |
+            std::views::transform([](auto k) { return 2 * std::sin(2.0 * k); });
+        const std::vector<double> coeff(coeff_range.begin(), coeff_range.end());
+        AberthResult result;
+        const auto dt = timeit([&]() { result = aberth_roots(coeff, pool); });
+        const auto error = backward_error(coeff, result.roots);
+        std::cout << std::setw(10) << degree << std::setw(10) << result.sweeps
+            << std::setw(14) << dt << std::setw(16) << std::setprecision(3) << error << std::endl;
+        print_test_result(result.converged && error < 1e-13, "backward error, degree " + std::to_string(degree));
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+#ifndef ABERTH_H
+#define ABERTH_H
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+using complex_t = std::complex<double>;
+
+// p(z) and p'(z) with a single pass of Horner's rule, p has coefficients
+// a[0], ..., a[n - 1] from the highest power if reversed, from the lowest otherwise.
+// The derivative follows the same recurrence one step behind
+inline void horner_derivative(const double* a, std::size_t n, bool reversed, complex_t z, complex_t& p, complex_t& dp) {
+    p = reversed ? a[0] : a[n - 1];
+    dp = 0;
+    for (std::size_t k = 1; k < n; ++k) {
+        dp = dp * z + p;
+        p = p * z + (reversed ? a[k] : a[n - 1 - k]);
+    }
+}
+
+// p'(z) / p(z). For |z| > 1 the powers of z overflow for high degrees, there we use
+// p(z) = z^n q(1/z) with q the reversed polynomial, so that
+// p'(z) / p(z) = (n - w q'(w) / q(w)) / z with w = 1 / z
+inline complex_t log_derivative(const std::vector<double>& a, complex_t z) {
+    const auto n = a.size() - 1;
+    complex_t p, dp;
+    if (std::abs(z) <= 1) {
+        horner_derivative(a.data(), a.size(), false, z, p, dp);
+        return dp / p;
+    }
+    const auto w = 1.0 / z;
+    horner_derivative(a.data(), a.size(), true, w, p, dp);
+    return (double(n) - w * dp / p) / z;
+}
+
+struct AberthResult {
+    std::vector<complex_t> roots;
+    unsigned int sweeps;
+    bool converged;
+};
+
+// All the roots of the polynomial with coefficients a (a[k] multiplies x^k) with the
+// Aberth-Ehrlich method: Newton's method on every root at the same time, where each
+// estimate is pushed away from the others,
+//   z_k <- z_k - 1 / (p'(z_k) / p(z_k) - sum_(j != k) 1 / (z_k - z_j)).
+// A sweep updates all the estimates from the ones of the previous sweep, so the roots
+// are independent and are split among the threads of the pool. A root whose
+// correction is smaller than tol |z_k| is frozen: it is not updated anymore, but it
+// still repels the others. The convergence is cubic for simple roots.
+inline AberthResult aberth_roots(const std::vector<double>& a,
+    ThreadPool& pool,
+    double tol = 1e-14,
+    unsigned int max_sweeps = 500) {
+    // zero leading coefficients do not change the roots
+    auto n = a.size();
+    while (n > 0 && a[n - 1] == 0)
+        --n;
+    if (n < 2)
+        throw std::invalid_argument("aberth_roots: the polynomial must have degree at least 1");
+    const std::vector<double> coeff(a.begin(), a.begin() + n);
+    const auto degree = n - 1;
+
+    // starting points on a circle with radius the geometric mean of the roots, the
+    // offset of the angle breaks the symmetry with respect to the real axis
+    const double radius = coeff[0] != 0 ? std::pow(std::abs(coeff[0] / coeff[degree]), 1.0 / degree) : 1.0;
+    AberthResult result{ std::vector<complex_t>(degree), 0, false };
+    auto& z = result.roots;
+    for (std::size_t k = 0; k < degree; ++k)
+        z[k] = std::polar(radius, 2 * std::numbers::pi * k / degree + 0.4);
+
+    std::vector<complex_t> z_new(z);
+    std::vector<char> frozen(degree, false);
+    std::size_t n_frozen = 0;
+    std::vector<char> frozen_now(degree, false);
+    while (n_frozen < degree && result.sweeps < max_sweeps) {
+        pool.parallel_for(degree, [&](std::size_t begin, std::size_t end) {
+            for (auto k = begin; k < end; ++k) {
+                if (frozen[k])
+                    continue;
+                complex_t repulsion = 0;
+                for (std::size_t j = 0; j < degree; ++j)
+                    if (j != k)
+                        repulsion += 1.0 / (z[k] - z[j]);
+                const auto ratio = log_derivative(coeff, z[k]);
+                const auto correction = 1.0 / (ratio - repulsion);
+                // p(z_k) = 0 gives an infinite ratio and a null correction
+                z_new[k] = z[k] - (std::isfinite(std::abs(correction)) ? correction : 0.0);
+                frozen_now[k] = !(std::abs(correction) > tol * std::abs(z[k]));
+            }
+        }, schedule::guided, 16);
+        for (std::size_t k = 0; k < degree; ++k) {
+            if (frozen[k])
+                continue;
+            z[k] = z_new[k];
+            if (frozen_now[k]) {
+                frozen[k] = true;
+                ++n_frozen;
+            }
+        }
+        ++result.sweeps;
+    }
+    result.converged = n_frozen == degree;
+    return result;
+}
+
+#endif /* ABERTH_H */
@@ -0,0 +1,125 @@
+#ifndef CHEBYSHEV_H
+#define CHEBYSHEV_H
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numbers>
+#include <vector>
+
+#include "horner.hpp"
+
+// Clenshaw's recurrence for sum_k c_k T_k(t), k = 0, ..., degree, t in [-1, 1]
+inline double clenshaw(const double* c, unsigned int degree, double t) {
+    double b1 = 0.0, b2 = 0.0;
+    for (auto k = degree; k > 0; --k) {
+        const double b0 = 2.0 * t * b1 - b2 + c[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    return t * b1 - b2 + c[0];
+}
+
+// the coefficients of the interpolant in the Chebyshev points of the first kind
+// t_k = cos(pi (k + 1/2) / (m + 1)), k = 0, ..., m, given the values there:
+// they are a discrete cosine transform of the values
+inline std::vector<double> chebyshev_coefficients(const std::vector<double>& values) {
+    const auto m = values.size() - 1;
+    std::vector<double> c(m + 1);
+    for (std::size_t j = 0; j <= m; ++j) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k <= m; ++k)
+            sum += values[k] * std::cos(std::numbers::pi * j * (k + 0.5) / (m + 1));
+        c[j] = (j == 0 ? 1.0 : 2.0) * sum / (m + 1);
+    }
+    return c;
+}
+
+// Piecewise Chebyshev approximation of a polynomial on a fixed interval [x_0, x_f].
+// The interval is bisected until on every piece the interpolant of low degree in the
+// Chebyshev points agrees with the polynomial up to the given tolerance. Building it costs
+// many evaluations of the polynomial, but afterwards each evaluation costs a search
+// of the piece plus 'degree' steps of Clenshaw's recurrence, instead of one step of Horner's
+// rule per coefficient of the polynomial. It pays off when the same polynomial is evaluated
+// many times on the same interval.
+// A piece is not bisected more than max_depth times, so there are at most 2^max_depth pieces:
+// a tolerance below the rounding errors of Horner's rule can not be met, converged() tells
+// whether it was.
+class ChebyshevCache {
+public:
+    ChebyshevCache(const std::vector<double>& a, double x0, double xf, double tol,
+        unsigned int degree = 12, unsigned int max_depth = 12)
+        : m_degree(degree), m_max_depth(max_depth), m_tol(tol), m_max_error(0.0) {
+        m_breaks.push_back(x0);
+        build(a, x0, xf, 0);
+    }
+
+    double operator()(double x) const {
+        // index of the piece containing x, the points outside the interval use the closest piece
+        const auto it = std::upper_bound(m_breaks.begin() + 1, m_breaks.end() - 1, x);
+        const auto i = static_cast<std::size_t>(it - m_breaks.begin() - 1);
+        const double a = m_breaks[i], b = m_breaks[i + 1];
+        return clenshaw(&m_coeffs[i * (m_degree + 1)], m_degree, (2.0 * x - a - b) / (b - a));
+    }
+
+    std::vector<double> evaluate(const std::vector<double>& points, bool parallel) const {
+        std::vector<double> result(points.size());
+        const auto compute = [this](double x) { return (*this)(x); };
+        if (parallel) {
+            std::transform(std::execution::par, points.begin(), points.end(), result.begin(), compute);
+        }
+        else {
+            std::transform(points.begin(), points.end(), result.begin(), compute);
+        }
+        return result;
+    }
+
+    std::size_t n_pieces() const { return m_breaks.size() - 1; }
+    // memory used by the tables, in bytes
+    std::size_t memory() const { return (m_breaks.size() + m_coeffs.size()) * sizeof(double); }
+    // largest error w.r.t. eval_horner measured while building the pieces
+    double max_error() const { return m_max_error; }
+    // whether the tolerance was met on all the pieces
+    bool converged() const { return !(m_max_error > m_tol); }
+
+private:
+    // approximate the polynomial on [a, b], obtained with 'depth' bisections of [x_0, x_f],
+    // the pieces are added from left to right
+    void build(const std::vector<double>& p, double a, double b, unsigned int depth) {
+        const auto m = m_degree;
+        // interpolation in the Chebyshev points of the first kind
+        std::vector<double> values(m + 1);
+        for (unsigned int k = 0; k <= m; ++k) {
+            const double t = std::cos(std::numbers::pi * (k + 0.5) / (m + 1));
+            values[k] = eval_horner(p, 0.5 * (a + b) + 0.5 * (b - a) * t);
+        }
+        const auto c = chebyshev_coefficients(values);
+        // check the error halfway between the interpolation points and at the ends
+        double error = 0.0;
+        for (unsigned int k = 0; k <= m + 1; ++k) {
+            const double t = std::cos(std::numbers::pi * k / (m + 1));
+            const double x = 0.5 * (a + b) + 0.5 * (b - a) * t;
+            error = std::max(error, std::abs(clenshaw(c.data(), m, t) - eval_horner(p, x)));
+        }
+        if (!(error > m_tol) || depth == m_max_depth) {
+            m_coeffs.insert(m_coeffs.end(), c.begin(), c.end());
+            m_breaks.push_back(b);
+            m_max_error = std::max(m_max_error, error);
+            return;
+        }
+        const double mid = 0.5 * (a + b);
+        build(p, a, mid, depth + 1);
+        build(p, mid, b, depth + 1);
+    }
+
+    const unsigned int m_degree;
+    const unsigned int m_max_depth;
+    const double m_tol;
+    double m_max_error;
+    // the i-th piece is [m_breaks[i], m_breaks[i+1]], its coefficients are
+    // m_coeffs[i * (m_degree + 1)], ..., m_coeffs[(i + 1) * (m_degree + 1) - 1]
+    std::vector<double> m_breaks;
+    std::vector<double> m_coeffs;
+};
+
+#endif /* CHEBYSHEV_H */
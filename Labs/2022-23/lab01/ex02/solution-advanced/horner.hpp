@@ -2,46 +2,26 @@
 #define HORNER_H
 
 #include <unordered_map>
+#include <cmath>
 #include <chrono>
-#include <regex>
-#include <fstream>
 #include <algorithm>
 #include <functional>
 #include <string>
+#include <vector>
+#include <numeric>
+#include <array>
+#include <bit>
+#include <stdexcept>
 
 #include <execution>
 
-using eval_method_t = std::function<double(const std::vector<double>&, double)>;
-
-// https://insanecoding.blogspot.com/2011/11/how-to-read-in-file-in-c.html
-std::string get_file_contents(const std::string& filename) {
-    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
-    if (in) {
-        std::string contents;
-        in.seekg(0, std::ios::end);
-        contents.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&contents[0], contents.size());
-        in.close();
-        return (contents);
-    }
-    throw(errno);
-}
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
 
-std::unordered_map<std::string, double> parse_parameters(const std::string& s) {
-    // https://stackoverflow.com/questions/638565/parsing-scientific-notation-sensibly
-    // https://en.cppreference.com/w/cpp/regex
-    const std::regex parameter_pattern(R"((\w+)=(-?(?:0|[1-9]\d*)(?:\.\d+)?(?:[eE][+\-]?\d+)?)(\n|\r\n)?)");
-    std::cmatch base_match;
-    std::unordered_map<std::string, double> parameters;
-    auto c = s.c_str();
-    while (std::regex_search(c, base_match, parameter_pattern)) {
-        c += base_match.length();
-        // conversion int to double is safe till 2^53-1
-        parameters.emplace(base_match[1], std::stod(base_match[2]));
-    }
-    return parameters;
-}
+using eval_method_t = std::function<double(const std::vector<double>&, double)>;
+// a function that evaluates the polynomial on all the points at once
+using poly_evaluator_t = std::function<std::vector<double>(const std::vector<double>&, const std::vector<double>&, bool)>;
 
 std::vector<double> evaluate_poly(const std::vector<double>& points,
     const std::vector<double>& a,
@@ -128,12 +108,276 @@ double eval_horner(const std::vector<double>& a, double x) {
     return result;
 }
 
+// Horner's rule is a single chain of dependent FMAs, so it is bound by the latency
+// of the FMA. Splitting the polynomial in K interleaved parts
+// p(x) = q_0(x^K) + x q_1(x^K) + ... + x^(K-1) q_(K-1)(x^K),
+// where q_j has coefficients a_j, a_(j+K), a_(j+2K), ..., gives K independent chains
+template<unsigned int K>
+double eval_horner_split(const std::vector<double>& a, double x) {
+    const double xk = pow_squaring(x, K);
+    double r[K] = {};
+    // the highest group of coefficients may be incomplete
+    auto i = (a.size() / K) * K;
+    for (unsigned int j = 0; i + j < a.size(); ++j)
+        r[j] = a[i + j];
+    while (i > 0) {
+        i -= K;
+        for (unsigned int j = 0; j < K; ++j)
+            r[j] = r[j] * xk + a[i + j];
+    }
+    // combine the K parts with Horner's rule in x
+    double result{ r[K - 1] };
+    for (unsigned int j = K - 1; j-- > 0;)
+        result = result * x + r[j];
+    return result;
+}
+
+namespace detail {
+    // Estrin's scheme on the coefficients a[0], ..., a[n-1], x2k[k] contains x^(2^k)
+    inline double estrin(const double* a, std::size_t n, const double* x2k) {
+        switch (n) {
+        case 1: return a[0];
+        case 2: return a[0] + a[1] * x2k[0];
+        case 3: return a[0] + a[1] * x2k[0] + a[2] * x2k[1];
+        case 4: return (a[0] + a[1] * x2k[0]) + x2k[1] * (a[2] + a[3] * x2k[0]);
+        }
+        // the lower part has 2^k coefficients, the biggest power of two smaller than n,
+        // the two recursive calls are independent and can be executed in parallel by the CPU
+        const auto k = std::bit_width(n - 1) - 1;
+        const std::size_t half = std::size_t{ 1 } << k;
+        return estrin(a, half, x2k) + x2k[k] * estrin(a + half, n - half, x2k);
+    }
+}
+
+// Estrin's scheme: p(x) = (a_0 + a_1 x) + x^2 (a_2 + a_3 x) + x^4 (...) + ...
+// evaluates the polynomial as a binary tree of depth log2(n) instead of a chain of length n
+double eval_estrin(const std::vector<double>& a, double x) {
+    std::array<double, 64> x2k;
+    x2k[0] = x;
+    for (std::size_t k = 1; k < std::bit_width(a.size()); ++k)
+        x2k[k] = x2k[k - 1] * x2k[k - 1];
+    return detail::estrin(a.data(), a.size(), x2k.data());
+}
+
+// the number of doubles in a SIMD register, chosen at compile time from the
+// instruction set we are compiling for (use -march=native)
+namespace simd {
+#if defined(__AVX512F__)
+    constexpr std::size_t width = 8;
+#elif defined(__AVX2__) && defined(__FMA__)
+    constexpr std::size_t width = 4;
+#else
+    constexpr std::size_t width = 1;
+#endif
+    // number of independent registers in flight, needed to hide the latency of the FMA
+    constexpr std::size_t unroll = 4;
+    // number of points evaluated by a single call of eval_horner_block
+    constexpr std::size_t block = width * unroll;
+}
+
+// Horner's rule on simd::block contiguous points at the same time: each lane of a
+// register holds a different point, so the lanes never depend on each other.
+// The steps continue from the values already in y, that is at the end
+// y = (...((y x + a[n-1]) x + a[n-2]) ...) x + a[0]
+// in this way a long polynomial can be processed a chunk of coefficients at a time
+inline void horner_block(const double* a, std::size_t n, const double* x, double* y) {
+    constexpr auto U = simd::unroll;
+#if defined(__AVX512F__)
+    constexpr auto W = simd::width;
+    __m512d xv[U], r[U];
+    for (std::size_t u = 0; u < U; ++u) {
+        xv[u] = _mm512_loadu_pd(x + u * W);
+        r[u] = _mm512_loadu_pd(y + u * W);
+    }
+    for (auto i = n; i-- > 0;) {
+        const auto c = _mm512_set1_pd(a[i]);
+        for (std::size_t u = 0; u < U; ++u)
+            r[u] = _mm512_fmadd_pd(r[u], xv[u], c);
+    }
+    for (std::size_t u = 0; u < U; ++u)
+        _mm512_storeu_pd(y + u * W, r[u]);
+#elif defined(__AVX2__) && defined(__FMA__)
+    constexpr auto W = simd::width;
+    __m256d xv[U], r[U];
+    for (std::size_t u = 0; u < U; ++u) {
+        xv[u] = _mm256_loadu_pd(x + u * W);
+        r[u] = _mm256_loadu_pd(y + u * W);
+    }
+    for (auto i = n; i-- > 0;) {
+        const auto c = _mm256_set1_pd(a[i]);
+        for (std::size_t u = 0; u < U; ++u)
+            r[u] = _mm256_fmadd_pd(r[u], xv[u], c);
+    }
+    for (std::size_t u = 0; u < U; ++u)
+        _mm256_storeu_pd(y + u * W, r[u]);
+#else
+    // scalar fallback, still U independent dependency chains
+    double r[U];
+    for (std::size_t u = 0; u < U; ++u)
+        r[u] = y[u];
+    for (auto i = n; i-- > 0;)
+        for (std::size_t u = 0; u < U; ++u)
+            r[u] = r[u] * x[u] + a[i];
+    for (std::size_t u = 0; u < U; ++u)
+        y[u] = r[u];
+#endif
+}
+
+// evaluates the polynomial on the points x[0], ..., x[simd::block - 1]
+inline void eval_horner_block(const std::vector<double>& a, const double* x, double* y) {
+    std::fill(y, y + simd::block, a.back());
+    horner_block(a.data(), a.size() - 1, x, y);
+}
+
+// out[i] = x[i]^e[i] for simd::block contiguous elements with exponentiation by squaring.
+// Each lane has its own exponent: at every step the lanes whose current exponent bit
+// is set multiply the result by their base, the others keep it unchanged (a mask
+// instead of a branch). So the block needs bit_width(max e) steps whatever the mix.
+inline void pow_block(const double* x, const unsigned int* e, double* out) {
+    constexpr auto U = simd::unroll;
+    const unsigned int steps = std::bit_width(*std::max_element(e, e + simd::block));
+#if defined(__AVX512F__)
+    constexpr auto W = simd::width;
+    const auto one = _mm512_set1_epi64(1);
+    // the zero masked forms with all the lanes selected: the plain _mm512_cvtepu32_epi64 and
+    // _mm512_srli_epi64 of GCC 12 pass _mm512_undefined_epi32() to the builtins, which
+    // gives a false -Wuninitialized warning when they are inlined. The instructions are the same
+    const __mmask8 all = 0xFF;
+    __m512d b[U], r[U];
+    __m512i ev[U];
+    for (std::size_t u = 0; u < U; ++u) {
+        b[u] = _mm512_loadu_pd(x + u * W);
+        r[u] = _mm512_set1_pd(1.0);
+        ev[u] = _mm512_maskz_cvtepu32_epi64(all, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(e + u * W)));
+    }
+    for (unsigned int s = 0; s < steps; ++s) {
+        for (std::size_t u = 0; u < U; ++u) {
+            const auto odd = _mm512_test_epi64_mask(ev[u], one);
+            r[u] = _mm512_mask_mul_pd(r[u], odd, r[u], b[u]);
+            b[u] = _mm512_mul_pd(b[u], b[u]);
+            ev[u] = _mm512_maskz_srli_epi64(all, ev[u], 1);
+        }
+    }
+    for (std::size_t u = 0; u < U; ++u)
+        _mm512_storeu_pd(out + u * W, r[u]);
+#elif defined(__AVX2__) && defined(__FMA__)
+    constexpr auto W = simd::width;
+    const auto one = _mm256_set1_epi64x(1);
+    __m256d b[U], r[U];
+    __m256i ev[U];
+    for (std::size_t u = 0; u < U; ++u) {
+        b[u] = _mm256_loadu_pd(x + u * W);
+        r[u] = _mm256_set1_pd(1.0);
+        ev[u] = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(e + u * W)));
+    }
+    for (unsigned int s = 0; s < steps; ++s) {
+        for (std::size_t u = 0; u < U; ++u) {
+            // all ones in the lanes with the bit set, blendv looks at the sign bit
+            const auto odd = _mm256_cmpeq_epi64(_mm256_and_si256(ev[u], one), one);
+            r[u] = _mm256_blendv_pd(r[u], _mm256_mul_pd(r[u], b[u]), _mm256_castsi256_pd(odd));
+            b[u] = _mm256_mul_pd(b[u], b[u]);
+            ev[u] = _mm256_srli_epi64(ev[u], 1);
+        }
+    }
+    for (std::size_t u = 0; u < U; ++u)
+        _mm256_storeu_pd(out + u * W, r[u]);
+#else
+    // scalar fallback, still U independent dependency chains
+    double b[U], r[U];
+    unsigned int ev[U];
+    for (std::size_t u = 0; u < U; ++u) {
+        b[u] = x[u];
+        r[u] = 1.0;
+        ev[u] = e[u];
+    }
+    for (unsigned int s = 0; s < steps; ++s) {
+        for (std::size_t u = 0; u < U; ++u) {
+            // a select and not the product of pow_branchless: 1 + (b - 1) is not b
+            // when b is much smaller than 1
+            r[u] = (ev[u] & 1) ? r[u] * b[u] : r[u];
+            b[u] *= b[u];
+            ev[u] >>= 1;
+        }
+    }
+    for (std::size_t u = 0; u < U; ++u)
+        out[u] = r[u];
+#endif
+}
+
+// out[i] = bases[i]^exps[i], out is resized if needed
+inline void pow_many(const std::vector<double>& bases,
+    const std::vector<unsigned int>& exps,
+    std::vector<double>& out) {
+    if (exps.size() < bases.size())
+        throw std::invalid_argument("pow_many: fewer exponents than bases");
+    out.resize(bases.size());
+    const auto n_blocks = bases.size() / simd::block;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+        pow_block(bases.data() + b * simd::block, exps.data() + b * simd::block, out.data() + b * simd::block);
+    for (auto i = n_blocks * simd::block; i < bases.size(); ++i)
+        out[i] = pow_squaring(bases[i], exps[i]);
+}
+
+std::vector<double> evaluate_poly_simd(const std::vector<double>& points,
+    const std::vector<double>& a,
+    bool parallel) {
+    std::vector<double> result(points.size());
+    // the blocks are independent of each other, we loop over their indices
+    std::vector<std::size_t> blocks(points.size() / simd::block);
+    std::iota(blocks.begin(), blocks.end(), 0);
+    const auto compute = [&a, &points, &result](std::size_t b) {
+        eval_horner_block(a, points.data() + b * simd::block, result.data() + b * simd::block);
+    };
+    if (parallel) {
+        std::for_each(std::execution::par, blocks.begin(), blocks.end(), compute);
+    }
+    else {
+        std::for_each(blocks.begin(), blocks.end(), compute);
+    }
+    // the points that do not fill a whole block are evaluated one by one
+    for (auto i = blocks.size() * simd::block; i < points.size(); ++i)
+        result[i] = eval_horner(a, points[i]);
+    return result;
+}
+
+// a method as a functor type: the function is a template argument, so the call
+// is resolved at compile time and can be inlined (no std::function in between)
+template<double (*Eval)(const std::vector<double>&, double)>
+struct method {
+    double operator()(const std::vector<double>& a, double x) const { return Eval(a, x); }
+};
+
+// same as evaluate_poly but the method is known at compile time, e.g.
+// evaluate_poly<method<eval_horner>>(points, a, parallel)
+template<typename Method>
+std::vector<double> evaluate_poly(const std::vector<double>& points,
+    const std::vector<double>& a,
+    bool parallel) {
+    std::vector<double> result(points.size());
+    const auto compute = [&a](double x) { return Method{}(a, x); };
+    if (parallel) {
+        std::transform(std::execution::par, points.begin(), points.end(), result.begin(), compute);
+    }
+    else {
+        std::transform(points.begin(), points.end(), result.begin(), compute);
+    }
+    return result;
+}
+
+// wraps a single point method into an evaluator of the whole vector of points
+poly_evaluator_t pointwise(eval_method_t method) {
+    return [method](const std::vector<double>& points, const std::vector<double>& a, bool parallel) {
+        return evaluate_poly(points, a, method, parallel);
+    };
+}
+
+template<typename Duration = std::chrono::milliseconds>
 auto timeit(const std::function<void()>& f) {
     using namespace std::chrono;
     const auto t0 = high_resolution_clock::now();
     f();
     const auto t1 = high_resolution_clock::now();
-    return duration_cast<milliseconds>(t1 - t0).count();
+    return duration_cast<Duration>(t1 - t0).count();
 }
 
 #endif /* HORNER_H */
\ No newline at end of file
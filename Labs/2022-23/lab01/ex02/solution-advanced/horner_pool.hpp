@@ -0,0 +1,24 @@
+#ifndef HORNER_POOL_H
+#define HORNER_POOL_H
+
+#include <vector>
+
+#include "horner.hpp"
+#include "thread_pool.hpp"
+
+// same as evaluate_poly<Method> but run on our thread pool, each thread is the first
+// to touch the part of the result it computes
+template<typename Method>
+std::vector<double, default_init_allocator<double>> evaluate_poly_pool(ThreadPool& pool,
+    const std::vector<double>& points,
+    const std::vector<double>& a,
+    schedule s = schedule::static_blocks) {
+    std::vector<double, default_init_allocator<double>> result(points.size());
+    pool.parallel_for(points.size(), [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+            result[i] = Method{}(a, points[i]);
+    }, s);
+    return result;
+}
+
+#endif /* HORNER_POOL_H */
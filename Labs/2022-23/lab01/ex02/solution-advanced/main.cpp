@@ -2,55 +2,152 @@
 #include <vector>
 #include <cmath>
 #include <ranges>
+#include <memory>
 
 #include "horner.hpp"
+#include "stream.hpp"
+#include "parameters.hpp"
+#include "chebyshev.hpp"
 
-int main() {
+int main(int argc, char* argv[]) {
     // parse parameter from file and print them
-    const auto parameters = parse_parameters(get_file_contents("params.dat"));
+    const ParameterFile parameters("params.dat");
     std::cout << "Parsed parameter are:" << std::endl;
-    for (const auto& [key, value] : parameters)
-        std::cout << "-- " << key << ": " << value << std::endl;
+    for (const auto& p : parameters)
+        std::cout << "-- " << p.key << ": " << p.value << std::endl;
 
     // save parameters locally for ease of use (optional)
-    const auto x0 = parameters.at("x_0");
-    const auto xf = parameters.at("x_f");
-    const auto n = static_cast<unsigned int>(parameters.at("n_points"));
-    const auto degree = static_cast<unsigned int>(parameters.at("degree"));
+    const auto x0 = parameters.get<double>("x_0");
+    const auto xf = parameters.get<double>("x_f");
+    const auto n = parameters.get<unsigned int>("n_points");
+    const auto degree = parameters.get<unsigned int>("degree");
     const auto h = (xf - x0) / (n - 1);
 
-    // construct vector of points and coefficients with ranges
+    // construct vector of coefficients with ranges
+    const auto coeff_range = std::ranges::views::iota(0u, degree + 1) |
+        std::ranges::views::transform([=](auto n)
+            { return 2 * std::sin(2.0 * n); });
+    const std::vector<double> coeff(coeff_range.begin(), coeff_range.end());
+
+    // in streaming mode the points are never stored all together: they are read from the
+    // binary file given as first argument (raw doubles) or computed on the fly on the grid,
+    // and the results are written to the file given as second argument
+    if (parameters.get<bool>("stream")) {
+        const auto chunk_size = parameters.get<std::size_t>("chunk_size");
+        const std::string output = argc > 2 ? argv[2] : "result.bin";
+        std::cout << "--------------------------------------" << std::endl;
+        std::cout << "  streaming execution, chunks of " << chunk_size << " points" << std::endl;
+        std::cout << "--------------------------------------" << std::endl;
+        const auto dt = timeit([&]() {
+            if (argc > 1) {
+                FilePoints file_points(argv[1]);
+                std::cout << "Computing " << file_points.size() << " evaluations of polynomial"
+                    << " with horner formula, points read from " << argv[1] << std::endl;
+                evaluate_poly_stream<method<eval_horner>>(file_points, coeff, output, chunk_size, true);
+            }
+            else {
+                GridPoints grid_points(x0, xf, n);
+                std::cout << "Computing " << n << " evaluations of polynomial"
+                    << " with horner formula" << std::endl;
+                evaluate_poly_stream<method<eval_horner>>(grid_points, coeff, output, chunk_size, true);
+            }
+        });
+        std::cout << "Elapsed: " << dt << " [ms], results written to " << output << std::endl;
+        return 0;
+    }
+
+    // construct vector of points with ranges
     const auto x_range = std::ranges::views::iota(0u, n) |
         std::ranges::views::transform([=](auto n)
             { return x0 + n * h; });
     const std::vector<double> points(x_range.begin(), x_range.end());
 
-    const auto coeff_range = std::ranges::views::iota(0u, degree + 1) |
-        std::ranges::views::transform([=](auto n)
-            { return 2 * std::sin(2.0 * n); });
-    const std::vector<double> coeff(coeff_range.begin(), coeff_range.end());
+    // piecewise Chebyshev approximation of the polynomial on [x_0, x_f], built once
+    const auto cheb_tol = parameters.get<double>("cheb_tol");
+    const auto cheb_degree = parameters.get<unsigned int>("cheb_degree");
+    std::unique_ptr<ChebyshevCache> cheb;
+    const auto dt_cheb = timeit<std::chrono::nanoseconds>([&]()
+        { cheb = std::make_unique<ChebyshevCache>(coeff, x0, xf, cheb_tol, cheb_degree); });
+    std::cout << "--------------------------------------" << std::endl;
+    std::cout << "  Chebyshev cache, tolerance " << cheb_tol << ", degree " << cheb_degree << std::endl;
+    std::cout << "--------------------------------------" << std::endl;
+    std::cout << "Built in " << dt_cheb / 1e6 << " [ms]: " << cheb->n_pieces() << " pieces, "
+        << cheb->memory() / 1024.0 << " [KiB], max error " << cheb->max_error() << std::endl;
+    if (!cheb->converged())
+        std::cout << "WARNING: the tolerance " << cheb_tol << " was not reached" << std::endl;
+    {
+        using std::chrono::nanoseconds;
+        const auto dt_horner = timeit<nanoseconds>([&]() { evaluate_poly<method<eval_horner>>(points, coeff, false); });
+        const auto dt_cached = timeit<nanoseconds>([&]() { cheb->evaluate(points, false); });
+        const double gain = double(dt_horner - dt_cached) / n;
+        std::cout << "Horner " << double(dt_horner) / n << " [ns] per point, cached "
+            << double(dt_cached) / n << " [ns] per point" << std::endl;
+        if (gain > 0)
+            std::cout << "The cache pays off after " << static_cast<std::size_t>(dt_cheb / gain) << " evaluations" << std::endl;
+        else
+            std::cout << "The cache does not pay off" << std::endl;
+    }
 
-    // define the tests we are going to perform and loop over them
-    const std::unordered_map<std::string, eval_method_t> TESTS = {
+    // define the tests we are going to perform and loop over them,
+    // the name of each method is mapped to the instantiation of evaluate_poly that inlines it
+    const std::unordered_map<std::string, poly_evaluator_t> TESTS = {
+        {"standard std::pow", evaluate_poly<method<eval_std>>},
+        {"standard integer pow", evaluate_poly<method<eval_pow_integer>>},
+        {"standard pow by squaring", evaluate_poly<method<eval_squaring>>},
+        {"standard pow branchless squaring", evaluate_poly<method<eval_branchless>>},
+        {"horner", evaluate_poly<method<eval_horner>>},
+        {"horner split 2", evaluate_poly<method<eval_horner_split<2>>>},
+        {"horner split 4", evaluate_poly<method<eval_horner_split<4>>>},
+        {"horner split 8", evaluate_poly<method<eval_horner_split<8>>>},
+        {"estrin", evaluate_poly<method<eval_estrin>>},
+        {"horner simd batched", evaluate_poly_simd},
+        {"chebyshev cache", [&cheb](const std::vector<double>& points, const std::vector<double>&, bool parallel)
+            { return cheb->evaluate(points, parallel); }},
+    };
+    // the same methods called through a std::function for every point
+    const std::unordered_map<std::string, eval_method_t> DYNAMIC_TESTS = {
         {"standard std::pow", eval_std},
         {"standard integer pow", eval_pow_integer},
         {"standard pow by squaring", eval_squaring},
         {"standard pow branchless squaring", eval_branchless},
         {"horner", eval_horner},
+        {"horner split 2", eval_horner_split<2>},
+        {"horner split 4", eval_horner_split<4>},
+        {"horner split 8", eval_horner_split<8>},
+        {"estrin", eval_estrin},
+    };
+    // reference values used to check the accuracy of the methods
+    const auto reference = evaluate_poly<method<eval_horner>>(points, coeff, false);
+    const auto max_abs = [](const auto& range) {
+        return std::ranges::max(range | std::ranges::views::transform([](double v) { return std::abs(v); }));
     };
+    const auto reference_norm = max_abs(reference);
     for (const auto parallel_policy : { true, false }) {
         std::cout << "--------------------------------------" << std::endl;
         std::cout << "  parallel execution: " << (parallel_policy ? "ON" : "OFF") << std::endl;
         std::cout << "--------------------------------------" << std::endl;
         for (const auto& [test_name, test_func] : TESTS) {
+            using std::chrono::nanoseconds;
             std::cout << "Computing " << n << " evaluations of polynomial"
                 << " with " << test_name << " formula" << std::endl;
-            const auto dt = timeit([&]()
-                { evaluate_poly(points, coeff, test_func, parallel_policy); });
-            std::cout << "Elapsed: " << dt << " [ms]" << std::endl;
+            std::vector<double> result;
+            const auto dt = timeit<nanoseconds>([&]()
+                { result = test_func(points, coeff, parallel_policy); });
+            std::cout << "Elapsed: " << dt / 1e6 << " [ms]"
+                << " (" << double(dt) / n << " [ns] per point)" << std::endl;
+            const auto error = std::views::iota(0u, n) |
+                std::views::transform([&](auto i) { return result[i] - reference[i]; });
+            std::cout << "Relative error w.r.t. horner: " << max_abs(error) / reference_norm << std::endl;
+
+            const auto dynamic = DYNAMIC_TESTS.find(test_name);
+            if (dynamic == DYNAMIC_TESTS.end())
+                continue;
+            const auto dt_dynamic = timeit<nanoseconds>([&]()
+                { evaluate_poly(points, coeff, dynamic->second, parallel_policy); });
+            std::cout << "Elapsed with std::function: " << dt_dynamic / 1e6 << " [ms]"
+                << " (overhead per point: " << double(dt_dynamic - dt) / n << " [ns])" << std::endl;
         }
     }
 
-
     return 0;
 }
\ No newline at end of file
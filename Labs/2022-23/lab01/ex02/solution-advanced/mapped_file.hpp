@@ -0,0 +1,80 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+
+// POSIX headers, memory mapping is not part of the standard library
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// read-only view of a whole file mapped in memory: the pages are loaded by the
+// operating system only when they are accessed, so nothing is copied and the file
+// can be much bigger than the available RAM
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filename) {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), filename);
+        struct stat st;
+        if (::fstat(fd, &st) < 0) {
+            const int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), filename);
+        }
+        m_size = static_cast<std::size_t>(st.st_size);
+        // mmap does not accept empty mappings
+        if (m_size > 0) {
+            void* ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED) {
+                const int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), filename);
+            }
+            m_data = static_cast<const char*>(ptr);
+        }
+        // the mapping stays valid after the file descriptor is closed
+        ::close(fd);
+    }
+
+    // the mapping owns a resource, copying it would unmap twice
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        if (m_data)
+            ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+    // hint that the file is going to be read from the beginning to the end
+    void advise_sequential() const {
+        if (m_data)
+            ::madvise(const_cast<char*>(m_data), m_size, MADV_SEQUENTIAL);
+    }
+
+    // give back to the operating system the pages before 'offset', which are not needed
+    // anymore; the data is still there, it is read again from the file if accessed
+    void release(std::size_t offset) {
+        const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto end = offset / page * page;
+        if (m_data && end > m_released) {
+            ::madvise(const_cast<char*>(m_data) + m_released, end - m_released, MADV_DONTNEED);
+            m_released = end;
+        }
+    }
+
+private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_released = 0;
+};
+
+#endif /* MAPPED_FILE_H */
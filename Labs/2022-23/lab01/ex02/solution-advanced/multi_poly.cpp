@@ -0,0 +1,66 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <ranges>
+
+#include "horner.hpp"
+#include "multi_poly.hpp"
+#include "parameters.hpp"
+
+// benchmark of the evaluation of many polynomials on the same points
+int main() {
+    const ParameterFile parameters("params.dat");
+    const auto x0 = parameters.get<double>("x_0");
+    const auto xf = parameters.get<double>("x_f");
+    const auto n = parameters.get<unsigned int>("n_points");
+    const auto degree = parameters.get<unsigned int>("degree");
+    const auto n_polys = parameters.get<unsigned int>("n_polys", 64);
+    const auto h = (xf - x0) / (n - 1);
+
+    const auto x_range = std::views::iota(0u, n) |
+        std::views::transform([=](auto i) { return x0 + i * h; });
+    const std::vector<double> points(x_range.begin(), x_range.end());
+
+    // the p-th polynomial has coefficients 2 sin(2k + p)
+    std::vector<std::vector<double>> polys;
+    for (unsigned int p = 0; p < n_polys; ++p) {
+        const auto coeff_range = std::views::iota(0u, degree + 1) |
+            std::views::transform([=](auto k) { return 2 * std::sin(2.0 * k + p); });
+        polys.emplace_back(coeff_range.begin(), coeff_range.end());
+    }
+
+    std::cout << "Computing " << n << " evaluations of " << n_polys
+        << " polynomials of degree " << degree << std::endl;
+    for (const auto parallel_policy : { true, false }) {
+        std::cout << "--------------------------------------" << std::endl;
+        std::cout << "  parallel execution: " << (parallel_policy ? "ON" : "OFF") << std::endl;
+        std::cout << "--------------------------------------" << std::endl;
+        std::vector<double> reference(std::size_t{ n_polys } * n);
+        const auto dt_loop = timeit([&]() {
+            for (unsigned int p = 0; p < n_polys; ++p) {
+                const auto r = evaluate_poly<method<eval_horner>>(points, polys[p], parallel_policy);
+                std::copy(r.begin(), r.end(), reference.begin() + std::size_t{ p } * n);
+            }
+        });
+        std::cout << "Loop over evaluate_poly with horner: " << dt_loop << " [ms]" << std::endl;
+
+        const auto dt_simd = timeit([&]() {
+            for (unsigned int p = 0; p < n_polys; ++p)
+                evaluate_poly_simd(points, polys[p], parallel_policy);
+        });
+        std::cout << "Loop over evaluate_poly_simd: " << dt_simd << " [ms]" << std::endl;
+
+        std::vector<double> result;
+        const auto dt_tiled = timeit([&]() { result = evaluate_polys(points, polys, parallel_policy); });
+        std::cout << "Tiled evaluate_polys: " << dt_tiled << " [ms]" << std::endl;
+
+        double error = 0.0, norm = 0.0;
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            error = std::max(error, std::abs(result[i] - reference[i]));
+            norm = std::max(norm, std::abs(reference[i]));
+        }
+        std::cout << "Relative error w.r.t. horner: " << error / norm << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#ifndef MULTI_POLY_H
+#define MULTI_POLY_H
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include "horner.hpp"
+
+// sizes of the tiles used by evaluate_polys
+namespace tile {
+    // number of points in a tile, must be a multiple of simd::block
+    constexpr std::size_t points = 16 * simd::block;
+    // number of polynomials in a tile
+    constexpr std::size_t polys = 8;
+    // number of coefficients of each polynomial processed before moving to the next one
+    constexpr std::size_t coeffs = 512;
+}
+
+// Evaluates many polynomials on the same points, result[p * points.size() + i] is the
+// value of the polynomial polys[p] at points[i].
+// Calling evaluate_poly for each polynomial streams all the points from memory once per
+// polynomial. Here the work is split in tiles of tile::polys polynomials times tile::points
+// points: inside a tile the points, the partial results and a chunk of tile::coeffs
+// coefficients for each polynomial are small enough to stay in cache while all the Horner
+// steps of the chunk are applied to them. The tiles are independent.
+std::vector<double> evaluate_polys(const std::vector<double>& points,
+    const std::vector<std::vector<double>>& polys,
+    bool parallel) {
+    const auto n = points.size();
+    std::vector<double> result(polys.size() * n);
+    std::size_t max_size = 0;
+    for (const auto& a : polys)
+        max_size = std::max(max_size, a.size());
+
+    // only the points that fill a whole SIMD block are evaluated in tiles
+    const auto n_blocked = n / simd::block * simd::block;
+    const auto n_point_tiles = (n_blocked + tile::points - 1) / tile::points;
+    const auto n_poly_tiles = (polys.size() + tile::polys - 1) / tile::polys;
+    const auto n_chunks = (max_size + tile::coeffs - 1) / tile::coeffs;
+
+    const auto compute = [&](std::size_t t) {
+        const auto i0 = (t % n_point_tiles) * tile::points;
+        const auto i1 = std::min(i0 + tile::points, n_blocked);
+        const auto p0 = (t / n_point_tiles) * tile::polys;
+        const auto p1 = std::min(p0 + tile::polys, polys.size());
+        // Horner starting from 0 is the same as starting from the leading coefficient,
+        // in this way polynomials with different degrees can be treated in the same way
+        for (auto p = p0; p < p1; ++p)
+            std::fill(result.begin() + p * n + i0, result.begin() + p * n + i1, 0.0);
+        // the chunks of coefficients go from the highest degree to the lowest
+        for (auto c = n_chunks; c-- > 0;) {
+            const auto k0 = c * tile::coeffs;
+            for (auto p = p0; p < p1; ++p) {
+                const auto& a = polys[p];
+                if (k0 >= a.size())
+                    continue;
+                const auto k1 = std::min(k0 + tile::coeffs, a.size());
+                for (auto i = i0; i < i1; i += simd::block)
+                    horner_block(a.data() + k0, k1 - k0, points.data() + i, result.data() + p * n + i);
+            }
+        }
+    };
+
+    std::vector<std::size_t> tiles(n_point_tiles * n_poly_tiles);
+    std::iota(tiles.begin(), tiles.end(), 0);
+    if (parallel) {
+        std::for_each(std::execution::par, tiles.begin(), tiles.end(), compute);
+    }
+    else {
+        std::for_each(tiles.begin(), tiles.end(), compute);
+    }
+    // the remaining points are evaluated one by one
+    for (std::size_t p = 0; p < polys.size(); ++p)
+        for (auto i = n_blocked; i < n; ++i)
+            result[p * n + i] = eval_horner(polys[p], points[i]);
+    return result;
+}
+
+#endif /* MULTI_POLY_H */
@@ -0,0 +1,57 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <string>
+#include <ranges>
+
+#include "horner.hpp"
+#include "multipoint.hpp"
+
+// benchmark and accuracy report of the piecewise Chebyshev evaluation against Horner's rule,
+// on a grid of degrees and number of points from 10^3 to the value given as first argument
+int main(int argc, char* argv[]) {
+    const unsigned int max_size = argc > 1 ? std::stoul(argv[1]) : 100000;
+    // above this number of operations Horner's rule is too slow and it is skipped
+    constexpr double max_horner_ops = 2e10;
+    constexpr double tol = 1e-11;
+
+    std::cout << std::setw(10) << "degree" << std::setw(10) << "points"
+        << std::setw(14) << "horner [ms]" << std::setw(14) << "fast [ms]" << std::setw(14) << "auto [ms]"
+        << std::setw(8) << "pieces" << std::setw(14) << "rel. error" << std::setw(10) << "auto" << std::endl;
+    for (unsigned int degree = 1000; degree <= max_size; degree *= 10) {
+        const auto coeff_range = std::views::iota(0u, degree + 1) |
+            std::views::transform([](auto k) { return 2 * std::sin(2.0 * k); });
+        const std::vector<double> coeff(coeff_range.begin(), coeff_range.end());
+        for (unsigned int n = 1000; n <= max_size; n *= 10) {
+            const double h = 2.0 / (n - 1);
+            const auto x_range = std::views::iota(0u, n) |
+                std::views::transform([=](auto i) { return -1.0 + i * h; });
+            const std::vector<double> points(x_range.begin(), x_range.end());
+
+            std::string dt_horner = "skipped";
+            if (double(n) * degree < max_horner_ops)
+                dt_horner = std::to_string(timeit([&]() { evaluate_poly_simd(points, coeff, true); }));
+            // the same steps of evaluate_poly_auto, with a budget of 4 Horner evaluations instead
+            // of 1/4 so that the accuracy is reported also where auto does not pick the interpolant
+            multipoint::interpolant p;
+            std::vector<double> result;
+            const auto dt_fast = timeit([&]() {
+                p = multipoint::build(coeff, -1.0, 1.0, tol, 4 * n, true);
+                if (p.converged)
+                    result = multipoint::evaluate(p, points, true);
+            });
+            const auto dt_auto = timeit([&]() { evaluate_poly_auto(points, coeff, true, tol); });
+            const bool use_fast = p.converged && p.n_evaluations <= n / 4;
+            std::cout << std::setw(10) << degree << std::setw(10) << n
+                << std::setw(14) << dt_horner << std::setw(14) << dt_fast << std::setw(14) << dt_auto;
+            if (p.converged)
+                std::cout << std::setw(8) << p.n_pieces()
+                    << std::setw(14) << std::setprecision(3) << sample_error(points, coeff, result, 1000);
+            else
+                std::cout << std::setw(22) << "over budget";
+            std::cout << std::setw(10) << (use_fast ? "fast" : "horner") << std::endl;
+        }
+    }
+    return 0;
+}
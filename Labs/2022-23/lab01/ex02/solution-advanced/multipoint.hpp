@@ -0,0 +1,182 @@
+#ifndef MULTIPOINT_H
+#define MULTIPOINT_H
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <limits>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+#include "horner.hpp"
+#include "chebyshev.hpp"
+
+// Fast evaluation of a polynomial of high degree d on many points, n of the same order as d.
+// Instead of d steps of Horner's rule per point, the polynomial is replaced on the interval
+// of the points by a piecewise Chebyshev interpolant of low degree, built by bisection until
+// on every piece it agrees with the polynomial up to a tolerance relative to its values.
+// Building it costs a few dozen evaluations of the polynomial per piece and the pieces grow
+// only like log(d) (they shrink near the ends of [-1, 1] where x^d varies), afterwards every
+// point costs a binary search and piece_degree steps of Clenshaw's recurrence.
+// The pieces of a level are evaluated together with evaluate_poly_simd.
+// This replaces the subproduct tree with FFT remainders: the products of (x - x_i) have
+// coefficients of the order of 2^m on m points in [-1, 1], so in double precision the
+// remainders had no correct digits above degree ~200, where the method would start to pay.
+namespace multipoint {
+    // degree of the interpolant on each piece
+    constexpr unsigned int piece_degree = 16;
+    // a piece is not bisected more than max_depth times
+    constexpr unsigned int max_depth = 40;
+    // below this degree Horner's rule costs about as much as Clenshaw's recurrence
+    constexpr std::size_t min_degree = 4 * piece_degree;
+
+    // the i-th piece is [breaks[i], breaks[i+1]], its coefficients are
+    // coeffs[i * (piece_degree + 1)], ..., coeffs[(i + 1) * (piece_degree + 1) - 1]
+    struct interpolant {
+        std::vector<double> breaks;
+        std::vector<double> coeffs;
+        // evaluations of the polynomial used to build it
+        std::size_t n_evaluations = 0;
+        // whether the tolerance was met on all the pieces within the budget
+        bool converged = false;
+
+        std::size_t n_pieces() const { return breaks.empty() ? 0 : breaks.size() - 1; }
+    };
+
+    // the interpolant of a on [lo, hi], with lo < hi, built one level of bisections at a time.
+    // On each piece the error at the extrema of T_(m+1) must be at most tol times the
+    // largest value seen so far, or the rounding error of Horner's rule, of the order of
+    // eps sum |a_k| |x|^k, which near |x| = 1 is the larger for high degrees; the build gives
+    // up, with converged = false, before using more than 'budget' evaluations of the polynomial
+    inline interpolant build(const std::vector<double>& a, double lo, double hi,
+        double tol, std::size_t budget, bool parallel) {
+        constexpr auto m = piece_degree;
+        // the interpolation points followed by the points where the error is checked
+        std::vector<double> t(2 * m + 3);
+        for (unsigned int k = 0; k <= m; ++k)
+            t[k] = std::cos(std::numbers::pi * (k + 0.5) / (m + 1));
+        for (unsigned int k = 0; k <= m + 1; ++k)
+            t[m + 1 + k] = std::cos(std::numbers::pi * k / (m + 1));
+
+        std::vector<double> abs_a(a.size());
+        std::transform(a.begin(), a.end(), abs_a.begin(), [](double c) { return std::abs(c); });
+
+        interpolant result;
+        // the accepted pieces, with their coefficients, and the ones still to check
+        std::vector<std::pair<double, std::vector<double>>> pieces;
+        std::vector<std::pair<double, double>> level{ { lo, hi } };
+        double scale = 0.0;
+        bool converged = true;
+        for (unsigned int depth = 0; !level.empty(); ++depth) {
+            // the sizes are rounded up to multiples of simd::block, since evaluate_poly_simd does
+            // the rest one point at a time; the padding is lo, a point of the interval
+            const auto padded = [](std::size_t size) { return (size + simd::block - 1) / simd::block * simd::block; };
+            std::vector<double> x(padded(level.size() * t.size()), lo), r(padded(level.size()));
+            if (result.n_evaluations + x.size() + r.size() > budget)
+                return result;
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                const auto [a_i, b_i] = level[i];
+                for (std::size_t k = 0; k < t.size(); ++k)
+                    x[i * t.size() + k] = 0.5 * (a_i + b_i) + 0.5 * (b_i - a_i) * t[k];
+                r[i] = std::max(std::abs(a_i), std::abs(b_i));
+            }
+            const auto values = evaluate_poly_simd(x, a, parallel);
+            const auto rounding = evaluate_poly_simd(r, abs_a, parallel);
+            result.n_evaluations += x.size() + r.size();
+            for (const auto v : values)
+                scale = std::max(scale, std::abs(v));
+
+            std::vector<std::pair<double, double>> next;
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                const auto v = values.begin() + i * t.size();
+                auto c = chebyshev_coefficients({ v, v + m + 1 });
+                double error = 0.0;
+                for (unsigned int k = 0; k <= m + 1; ++k)
+                    error = std::max(error, std::abs(clenshaw(c.data(), m, t[m + 1 + k]) - v[m + 1 + k]));
+                // written in this way a nan is never accepted
+                const bool ok = error <= std::max(tol * scale, std::numeric_limits<double>::epsilon() * rounding[i]);
+                const auto [a_i, b_i] = level[i];
+                if (ok || depth == max_depth) {
+                    converged = converged && ok;
+                    pieces.emplace_back(a_i, std::move(c));
+                }
+                else {
+                    const double mid = 0.5 * (a_i + b_i);
+                    next.emplace_back(a_i, mid);
+                    next.emplace_back(mid, b_i);
+                }
+            }
+            level = std::move(next);
+        }
+
+        // the pieces of different levels are not in order
+        std::sort(pieces.begin(), pieces.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+        for (const auto& [a_i, c] : pieces) {
+            result.breaks.push_back(a_i);
+            result.coeffs.insert(result.coeffs.end(), c.begin(), c.end());
+        }
+        result.breaks.push_back(hi);
+        result.converged = converged;
+        return result;
+    }
+
+    inline double evaluate(const interpolant& p, double x) {
+        // index of the piece containing x, the points outside the interval use the closest piece
+        const auto it = std::upper_bound(p.breaks.begin() + 1, p.breaks.end() - 1, x);
+        const auto i = static_cast<std::size_t>(it - p.breaks.begin() - 1);
+        const double a = p.breaks[i], b = p.breaks[i + 1];
+        return clenshaw(&p.coeffs[i * (piece_degree + 1)], piece_degree, (2.0 * x - a - b) / (b - a));
+    }
+
+    inline std::vector<double> evaluate(const interpolant& p, const std::vector<double>& points, bool parallel) {
+        std::vector<double> result(points.size());
+        const auto compute = [&p](double x) { return evaluate(p, x); };
+        if (parallel) {
+            std::transform(std::execution::par, points.begin(), points.end(), result.begin(), compute);
+        }
+        else {
+            std::transform(points.begin(), points.end(), result.begin(), compute);
+        }
+        return result;
+    }
+}
+
+// relative error of the values at the points of a sample, w.r.t. eval_horner
+double sample_error(const std::vector<double>& points,
+    const std::vector<double>& a,
+    const std::vector<double>& values,
+    std::size_t n_sample) {
+    const auto step = std::max<std::size_t>(1, points.size() / n_sample);
+    double error = 0.0, norm = 0.0;
+    for (std::size_t i = 0; i < points.size(); i += step) {
+        const auto reference = eval_horner(a, points[i]);
+        // written in this way a nan in the values gives an infinite error
+        const auto diff = std::abs(values[i] - reference);
+        error = diff <= error ? error : (std::isnan(diff) ? INFINITY : diff);
+        norm = std::max(norm, std::abs(reference));
+    }
+    return norm > 0 ? error / norm : error;
+}
+
+// The interpolant is built only while it costs less than a quarter of Horner's rule on all
+// the points: if it does not converge within that budget we fall back to evaluate_poly_simd,
+// having wasted at most 25%, otherwise the points are evaluated with the interpolant.
+// So the crossover is decided by the polynomial itself and no work is done twice.
+// 'tol' is relative to the largest value of the polynomial on the points
+std::vector<double> evaluate_poly_auto(const std::vector<double>& points,
+    const std::vector<double>& a,
+    bool parallel,
+    double tol = 1e-11) {
+    if (a.size() > multipoint::min_degree && !points.empty()) {
+        const auto [lo, hi] = std::minmax_element(points.begin(), points.end());
+        if (*lo < *hi) {
+            const auto p = multipoint::build(a, *lo, *hi, tol, points.size() / 4, parallel);
+            if (p.converged)
+                return multipoint::evaluate(p, points, parallel);
+        }
+    }
+    return evaluate_poly_simd(points, a, parallel);
+}
+
+#endif /* MULTIPOINT_H */
@@ -0,0 +1,167 @@
+#ifndef PARAMETERS_H
+#define PARAMETERS_H
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "mapped_file.hpp"
+
+// Reader for files of parameters in the format
+//   # a comment
+//   key=value
+// one per line, spaces around '=' are allowed. The file is mapped in memory and scanned
+// once, keys and values are views on the mapped file, so nothing is copied and the
+// values are converted only when they are requested with get<T>().
+class ParameterFile {
+public:
+    explicit ParameterFile(const std::string& filename) : m_filename(filename), m_file(filename) {
+        parse();
+    }
+
+    bool contains(std::string_view key) const { return m_index.contains(key); }
+
+    // get the value of a parameter converted to T, which can be bool,
+    // an integer or a floating point type
+    template<typename T>
+    T get(std::string_view key) const {
+        const auto it = m_index.find(key);
+        if (it == m_index.end())
+            throw std::runtime_error(m_filename + ": parameter '" + std::string(key) + "' not found");
+        const auto& [name, value, line] = m_entries[it->second];
+        if constexpr (std::is_same_v<T, bool>) {
+            if (value == "true" || value == "1")
+                return true;
+            if (value == "false" || value == "0")
+                return false;
+            error(line, "parameter '" + std::string(key) + "' is not a boolean: '" + std::string(value) + "'");
+        }
+        else {
+            static_assert(std::is_arithmetic_v<T>, "parameters can be only bool, integers or floating point");
+            const char* const first = value.data();
+            const char* const last = first + value.size();
+            T result{};
+            auto [ptr, ec] = std::from_chars(first, last, result);
+            if constexpr (std::is_integral_v<T>) {
+                // integers may also be written as floating point numbers, e.g. 1e6 or 100.0,
+                // as long as their value is an integer that fits in T
+                if (ec == std::errc() && ptr != last) {
+                    double d{};
+                    const auto parsed = std::from_chars(first, last, d);
+                    ptr = parsed.ptr;
+                    ec = parsed.ec;
+                    if (ec == std::errc() && ptr == last) {
+                        if (d != std::trunc(d))
+                            ec = std::errc::invalid_argument;
+                        else if (!in_range<T>(d))
+                            ec = std::errc::result_out_of_range;
+                        else
+                            result = static_cast<T>(d);
+                    }
+                }
+            }
+            if (ec == std::errc::result_out_of_range)
+                error(line, "parameter '" + std::string(key) + "' is out of range: '" + std::string(value) + "'");
+            if (ec != std::errc() || ptr != last)
+                error(line, "parameter '" + std::string(key) + "' is not a valid " +
+                    (std::is_integral_v<T> ? (std::is_signed_v<T> ? "integer" : "unsigned integer") : "number") +
+                    ": '" + std::string(value) + "'");
+            return result;
+        }
+    }
+
+    // get the value of a parameter, or 'fallback' if it is not in the file
+    template<typename T>
+    T get(std::string_view key, T fallback) const {
+        return contains(key) ? get<T>(key) : fallback;
+    }
+
+    struct Entry {
+        std::string_view key;
+        std::string_view value;
+        std::size_t line;
+    };
+
+    // iteration over the entries in the same order of the file
+    auto begin() const { return m_entries.begin(); }
+    auto end() const { return m_entries.end(); }
+    std::size_t size() const { return m_entries.size(); }
+
+private:
+    [[noreturn]] void error(std::size_t line, const std::string& msg) const {
+        throw std::runtime_error(m_filename + ":" + std::to_string(line) + ": " + msg);
+    }
+
+    // whether the integer value d can be represented by T, that is -2^digits <= d < 2^digits
+    // (d >= 0 if T is unsigned); 2^digits is exact in double even when T's max is not
+    template<typename T>
+    static bool in_range(double d) {
+        const double bound = std::ldexp(1.0, std::numeric_limits<T>::digits);
+        return d < bound && (std::is_signed_v<T> ? d >= -bound : d >= 0.0);
+    }
+
+    static bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+    static bool is_key(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    void parse() {
+        const char* c = m_file.data();
+        const char* const end = c + m_file.size();
+        for (std::size_t line = 1; c < end; ++line) {
+            const char* const eol = std::find(c, end, '\n');
+            // the last line may not end with '\n'
+            const char* const next = eol < end ? eol + 1 : end;
+            while (c < eol && is_blank(*c))
+                ++c;
+            // empty line or comment
+            if (c == eol || *c == '#') {
+                c = next;
+                continue;
+            }
+            const char* const key_begin = c;
+            while (c < eol && is_key(*c))
+                ++c;
+            const std::string_view key(key_begin, c - key_begin);
+            if (key.empty())
+                error(line, "expected the name of a parameter");
+            while (c < eol && is_blank(*c))
+                ++c;
+            if (c == eol || *c != '=')
+                error(line, "expected '=' after '" + std::string(key) + "'");
+            ++c;
+            while (c < eol && is_blank(*c))
+                ++c;
+            const char* const value_begin = c;
+            while (c < eol && !is_blank(*c) && *c != '#')
+                ++c;
+            const std::string_view value(value_begin, c - value_begin);
+            if (value.empty())
+                error(line, "missing value for '" + std::string(key) + "'");
+            while (c < eol && is_blank(*c))
+                ++c;
+            if (c != eol && *c != '#')
+                error(line, "unexpected characters after the value of '" + std::string(key) + "'");
+            const auto [it, inserted] = m_index.emplace(key, m_entries.size());
+            if (!inserted)
+                error(line, "parameter '" + std::string(key) + "' already defined at line " +
+                    std::to_string(m_entries[it->second].line));
+            m_entries.push_back(Entry{ key, value, line });
+            c = next;
+        }
+    }
+
+    const std::string m_filename;
+    MappedFile m_file;
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string_view, std::size_t> m_index;
+};
+
+#endif /* PARAMETERS_H */
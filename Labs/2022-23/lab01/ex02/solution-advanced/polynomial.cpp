@@ -0,0 +1,94 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <string>
+
+#include "horner.hpp"
+#include "polynomial.hpp"
+
+// utility for printing the result of a test
+void print_test_result(bool r, const std::string& test_name) {
+    std::cout << test_name << " test: " << (r ? "PASSED" : "FAILED") << std::endl;
+}
+
+std::vector<double> random_poly(std::size_t size, std::mt19937& engine) {
+    std::uniform_real_distribution<> distrib(-1.0, 1.0);
+    std::vector<double> a(size);
+    for (auto& v : a)
+        v = distrib(engine);
+    return a;
+}
+
+// tests and benchmark of the polynomial arithmetic
+int main() {
+    std::mt19937 engine(42);
+    using std::chrono::microseconds;
+
+    std::cout << "-- tests --------------------------" << std::endl;
+    {
+        const auto a = random_poly(3000, engine), b = random_poly(2000, engine);
+        const auto c = poly::mul(a, b);
+        const auto c_ref = poly::mul_schoolbook(a, b);
+        double error = 0.0;
+        for (std::size_t i = 0; i < c.size(); ++i)
+            error = std::max(error, std::abs(c[i] - c_ref[i]));
+        print_test_result(error < 1e-10, "fft product");
+
+        // 1 / (1 - x/2) = sum (x/2)^k
+        const auto inv = poly::inverse({ 1.0, -0.5 }, 1000);
+        error = 0.0;
+        for (std::size_t k = 0; k < inv.size(); ++k)
+            error = std::max(error, std::abs(inv[k] - std::pow(0.5, k)));
+        print_test_result(error < 1e-14, "inverse");
+
+        const auto d = poly::derivative(poly::antiderivative(a, 1.0));
+        error = 0.0;
+        for (std::size_t k = 0; k < a.size(); ++k)
+            error = std::max(error, std::abs(d[k] - a[k]));
+        print_test_result(d.size() == a.size() && error < 1e-12, "derivative of antiderivative");
+
+        // |q(x)| < 1 keeps p(q(x)) well conditioned
+        const auto p = random_poly(300, engine);
+        auto q = random_poly(5, engine);
+        for (auto& v : q)
+            v *= 0.2;
+        const auto pq = poly::compose(p, q);
+        bool ok = pq.size() == (p.size() - 1) * (q.size() - 1) + 1;
+        for (const double x : { -0.3, 0.1, 0.25 }) {
+            const auto ref = eval_horner(p, eval_horner(q, x));
+            ok = ok && std::abs(eval_horner(pq, x) - ref) <= 1e-9 * std::max(1.0, std::abs(ref));
+        }
+        print_test_result(ok, "composition");
+    }
+
+    // the size at which the FFT product becomes faster than the schoolbook one,
+    // poly::mul_threshold should be set to this value
+    std::cout << "-- schoolbook vs fft product ------" << std::endl;
+    std::cout << std::setw(8) << "size" << std::setw(18) << "schoolbook [us]" << std::setw(12) << "fft [us]" << std::endl;
+    for (std::size_t n = 16; n <= 2048; n *= 2) {
+        const auto a = random_poly(n, engine), b = random_poly(n, engine);
+        const int reps = 100000 / n + 1;
+        const auto dt_school = timeit<microseconds>([&]() { for (int r = 0; r < reps; ++r) poly::mul_schoolbook(a, b); });
+        const auto dt_fft = timeit<microseconds>([&]() { for (int r = 0; r < reps; ++r) poly::mul_fft(a, b); });
+        std::cout << std::setw(8) << n << std::setw(18) << double(dt_school) / reps
+            << std::setw(12) << double(dt_fft) / reps << std::endl;
+    }
+
+    std::cout << "-- high degree products -----------" << std::endl;
+    for (std::size_t n = 10000; n <= 1000000; n *= 10) {
+        const auto a = random_poly(n, engine), b = random_poly(n, engine);
+        const auto dt_fft = timeit([&]() { poly::mul(a, b); });
+        std::cout << "degree " << n << ": fft " << dt_fft << " [ms]";
+        if (n <= 10000)
+            std::cout << ", schoolbook " << timeit([&]() { poly::mul_schoolbook(a, b); }) << " [ms]";
+        std::cout << std::endl;
+    }
+    {
+        const auto p = random_poly(1001, engine), q = random_poly(11, engine);
+        std::cout << "composition of degree 1000 and 10: "
+            << timeit([&]() { poly::compose(p, q); }) << " [ms]" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+#ifndef POLYNOMIAL_H
+#define POLYNOMIAL_H
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+// Arithmetic on polynomials stored as the vector of their coefficients (a_0, ..., a_n),
+// the same representation used by eval_horner and the other evaluation methods
+namespace poly {
+    using cplx = std::complex<double>;
+
+    // below this size the products are computed with the schoolbook O(n^2) algorithm.
+    // The crossover printed by polynomial.cpp depends on the machine and on the flags:
+    // with -O3 it was 64 on the machine this value was set on and 128 on a Xeon, with
+    // -march=native the schoolbook loop is vectorized and it grows up to 512 on the Xeon
+    constexpr std::size_t mul_threshold = 64;
+
+    // product of two complex numbers without the checks for inf and nan done by std::complex
+    inline cplx cmul(cplx a, cplx b) {
+        return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+    }
+
+    // the roots of unity exp(-2 pi i k / n), k = 0, ..., n/2 - 1, they are computed
+    // directly (not by repeated products) for accuracy and cached since they are expensive
+    inline const std::vector<cplx>& roots_of_unity(std::size_t n) {
+        thread_local std::vector<std::vector<cplx>> cache(64);
+        auto& w = cache[std::bit_width(n) - 1];
+        if (w.empty()) {
+            w.resize(n / 2);
+            for (std::size_t k = 0; k < n / 2; ++k)
+                w[k] = std::polar(1.0, -2.0 * std::numbers::pi * k / n);
+        }
+        return w;
+    }
+
+    // in-place iterative radix-2 FFT, the size of v must be a power of two
+    inline void fft(std::vector<cplx>& v, bool inverse) {
+        const auto n = v.size();
+        // bit reversal permutation
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            auto bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            if (i < j)
+                std::swap(v[i], v[j]);
+        }
+        const auto& w = roots_of_unity(n);
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const auto half = len / 2;
+            const auto step = n / len;
+            for (std::size_t j = 0; j < half; ++j) {
+                const auto wj = inverse ? std::conj(w[j * step]) : w[j * step];
+                for (std::size_t i = j; i < n; i += len) {
+                    const auto u = v[i];
+                    const auto t = cmul(wj, v[i + half]);
+                    v[i] = u + t;
+                    v[i + half] = u - t;
+                }
+            }
+        }
+        if (inverse)
+            for (auto& x : v)
+                x /= static_cast<double>(n);
+    }
+
+    inline std::vector<double> mul_schoolbook(const std::vector<double>& a, const std::vector<double>& b) {
+        std::vector<double> c(a.size() + b.size() - 1);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            for (std::size_t j = 0; j < b.size(); ++j)
+                c[i + j] += a[i] * b[j];
+        return c;
+    }
+
+    // a and b are real, so we can transform both with a single complex FFT of a + ib
+    inline std::vector<double> mul_fft(const std::vector<double>& a, const std::vector<double>& b) {
+        const auto size = a.size() + b.size() - 1;
+        const auto n = std::bit_ceil(size);
+        std::vector<cplx> z(n);
+        for (std::size_t i = 0; i < a.size(); ++i)
+            z[i].real(a[i]);
+        for (std::size_t i = 0; i < b.size(); ++i)
+            z[i].imag(b[i]);
+        fft(z, false);
+        // with Z = FFT(a + ib) we have A_k = (Z_k + conj(Z_(n-k))) / 2 and
+        // B_k = (Z_k - conj(Z_(n-k))) / 2i, hence A_k B_k = (Z_k^2 - conj(Z_(n-k))^2) / 4i
+        std::vector<cplx> c(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            const auto zk = z[k];
+            const auto zj = std::conj(z[(n - k) & (n - 1)]);
+            c[k] = cmul(cmul(zk, zk) - cmul(zj, zj), cplx(0.0, -0.25));
+        }
+        fft(c, true);
+        std::vector<double> result(size);
+        for (std::size_t i = 0; i < size; ++i)
+            result[i] = c[i].real();
+        return result;
+    }
+
+    // sum of two polynomials
+    inline std::vector<double> add(const std::vector<double>& a, const std::vector<double>& b) {
+        std::vector<double> c(std::max(a.size(), b.size()));
+        for (std::size_t i = 0; i < a.size(); ++i)
+            c[i] += a[i];
+        for (std::size_t i = 0; i < b.size(); ++i)
+            c[i] += b[i];
+        return c;
+    }
+
+    // product of two polynomials
+    inline std::vector<double> mul(const std::vector<double>& a, const std::vector<double>& b) {
+        if (a.empty() || b.empty())
+            return {};
+        if (std::min(a.size(), b.size()) < mul_threshold)
+            return mul_schoolbook(a, b);
+        return mul_fft(a, b);
+    }
+
+    // the first n coefficients of the power series 1 / f, requires f_0 != 0.
+    // Newton's iteration g <- g (2 - f g) doubles the number of correct coefficients at each step
+    inline std::vector<double> inverse(const std::vector<double>& f, std::size_t n) {
+        std::vector<double> g{ 1.0 / f[0] };
+        for (std::size_t k = 1; k < n; k *= 2) {
+            const auto m = std::min(2 * k, n);
+            const std::vector<double> f_m(f.begin(), f.begin() + std::min(m, f.size()));
+            // e = f g - 1 mod x^m, its first k coefficients are zero
+            auto e = mul(f_m, g);
+            e.resize(m);
+            e[0] -= 1.0;
+            auto c = mul(g, e);
+            g.resize(m);
+            for (std::size_t i = 0; i < m; ++i)
+                g[i] -= c[i];
+        }
+        g.resize(n);
+        return g;
+    }
+
+    // remainder of the division of a by m with the long division, O(deg(a) deg(m)) but more
+    // accurate than rem when the coefficients of m span many orders of magnitude
+    inline std::vector<double> rem_long(const std::vector<double>& a, const std::vector<double>& m) {
+        const auto d = m.size() - 1;
+        if (a.size() <= d)
+            return a;
+        std::vector<double> r(a);
+        for (auto i = a.size(); i-- > d;) {
+            const auto q = r[i] / m[d];
+            for (std::size_t j = 0; j <= d; ++j)
+                r[i - d + j] -= q * m[j];
+        }
+        r.resize(d);
+        return r;
+    }
+
+    // remainder of the division of a by m, the leading coefficient of m must be non zero
+    inline std::vector<double> rem(const std::vector<double>& a, const std::vector<double>& m) {
+        const auto d = m.size() - 1;
+        if (a.size() <= d)
+            return a;
+        const auto nq = a.size() - d;
+        if (std::min(nq, d) < mul_threshold)
+            return rem_long(a, m);
+        // the reversed quotient is rev(a) / rev(m) mod x^nq
+        const std::vector<double> ra(a.rbegin(), a.rbegin() + nq);
+        const std::vector<double> rm(m.rbegin(), m.rend());
+        auto q = mul(ra, inverse(rm, nq));
+        q.resize(nq);
+        std::reverse(q.begin(), q.end());
+        const auto qm = mul(q, m);
+        std::vector<double> r(a.begin(), a.begin() + d);
+        for (std::size_t i = 0; i < d; ++i)
+            r[i] -= qm[i];
+        return r;
+    }
+
+    // the derivative (a_1, 2 a_2, ..., n a_n)
+    inline std::vector<double> derivative(const std::vector<double>& a) {
+        if (a.size() <= 1)
+            return {};
+        std::vector<double> d(a.size() - 1);
+        for (std::size_t k = 1; k < a.size(); ++k)
+            d[k - 1] = k * a[k];
+        return d;
+    }
+
+    // the antiderivative with constant term c, that is (c, a_0, a_1 / 2, ..., a_n / (n + 1))
+    inline std::vector<double> antiderivative(const std::vector<double>& a, double c = 0.0) {
+        std::vector<double> A(a.size() + 1);
+        A[0] = c;
+        for (std::size_t k = 0; k < a.size(); ++k)
+            A[k + 1] = a[k] / (k + 1.0);
+        return A;
+    }
+
+    namespace detail {
+        // p(q) where p has coefficients p[0], ..., p[n-1] and q2k[k] = q^(2^k),
+        // divided as p_lo(q) + q^h p_hi(q) like in Estrin's scheme, so that the products
+        // are between polynomials of similar size and can exploit the FFT
+        inline std::vector<double> compose(const double* p, std::size_t n, const std::vector<std::vector<double>>& q2k) {
+            if (n <= 4) {
+                // Horner's rule
+                std::vector<double> r{ p[n - 1] };
+                for (auto i = n - 1; i-- > 0;) {
+                    r = mul(r, q2k[0]);
+                    r[0] += p[i];
+                }
+                return r;
+            }
+            const auto k = std::bit_width(n - 1) - 1;
+            const std::size_t half = std::size_t{ 1 } << k;
+            return add(compose(p, half, q2k), mul(q2k[k], compose(p + half, n - half, q2k)));
+        }
+    }
+
+    // the composition p(q(x)), it has degree deg(p) deg(q)
+    inline std::vector<double> compose(const std::vector<double>& p, const std::vector<double>& q) {
+        if (p.empty())
+            return {};
+        if (q.empty())
+            return { p[0] };
+        std::vector<std::vector<double>> q2k{ q };
+        while ((std::size_t{ 1 } << q2k.size()) < p.size())
+            q2k.push_back(mul(q2k.back(), q2k.back()));
+        return detail::compose(p.data(), p.size(), q2k);
+    }
+}
+
+#endif /* POLYNOMIAL_H */
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <ranges>
+#include <thread>
+
+#include "horner.hpp"
+#include "horner_pool.hpp"
+#include "parameters.hpp"
+
+// speedup of the evaluation on our thread pool w.r.t. the pool with a single thread,
+// with the polynomial and the points of params.dat
+int main() {
+    const ParameterFile parameters("params.dat");
+    const auto x0 = parameters.get<double>("x_0");
+    const auto xf = parameters.get<double>("x_f");
+    const auto n = parameters.get<unsigned int>("n_points");
+    const auto degree = parameters.get<unsigned int>("degree");
+    const auto h = (xf - x0) / (n - 1);
+
+    const auto coeff_range = std::ranges::views::iota(0u, degree + 1) |
+        std::ranges::views::transform([=](auto n)
+            { return 2 * std::sin(2.0 * n); });
+    const std::vector<double> coeff(coeff_range.begin(), coeff_range.end());
+    const auto x_range = std::ranges::views::iota(0u, n) |
+        std::ranges::views::transform([=](auto n)
+            { return x0 + n * h; });
+    const std::vector<double> points(x_range.begin(), x_range.end());
+
+    std::cout << "--------------------------------------" << std::endl;
+    std::cout << "  parallel execution: POOL" << std::endl;
+    std::cout << "--------------------------------------" << std::endl;
+    std::cout << "Computing " << n << " evaluations of polynomial with horner formula" << std::endl;
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> thread_counts;
+    for (unsigned int n_threads = 1; n_threads < max_threads; n_threads *= 2)
+        thread_counts.push_back(n_threads);
+    thread_counts.push_back(max_threads);
+    double dt_serial[2] = {};
+    for (const auto n_threads : thread_counts) {
+        ThreadPool pool(n_threads, true);
+        for (const auto s : { schedule::static_blocks, schedule::guided }) {
+            const auto dt = timeit<std::chrono::nanoseconds>([&]()
+                { evaluate_poly_pool<method<eval_horner>>(pool, points, coeff, s); }) / 1e6;
+            auto& dt1 = dt_serial[s == schedule::guided];
+            if (n_threads == 1)
+                dt1 = dt;
+            std::cout << n_threads << " threads, " << (s == schedule::guided ? "guided" : "static")
+                << " schedule: " << dt << " [ms] (speedup " << dt1 / dt << ")" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <string>
+#include <random>
+
+#include "horner.hpp"
+
+// benchmark of pow_many against the scalar loops and std::pow, on several mixes of
+// exponents; the number of elements is given as first argument
+int main(int argc, char* argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1 << 22;
+
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<double> base_distrib(0.9, 1.1);
+    std::vector<double> bases(n);
+    for (auto& b : bases)
+        b = base_distrib(engine);
+
+    // each mix returns a random exponent
+    std::uniform_int_distribution<unsigned int> small(0, 15), large(0, 1000), coin(0, 99);
+    const std::vector<std::pair<std::string, std::function<unsigned int()>>> mixes = {
+        { "small [0, 15]", [&]() { return small(engine); } },
+        { "large [0, 1000]", [&]() { return large(engine); } },
+        { "1% large", [&]() { return coin(engine) == 0 ? large(engine) : small(engine); } },
+    };
+
+    std::cout << std::setw(18) << "exponents" << std::setw(14) << "std::pow"
+        << std::setw(14) << "squaring" << std::setw(14) << "branchless"
+        << std::setw(14) << "pow_many" << std::setw(14) << "rel. error" << "  [ms]" << std::endl;
+    for (const auto& [name, exponent] : mixes) {
+        std::vector<unsigned int> exps(n);
+        for (auto& e : exps)
+            e = exponent();
+
+        std::vector<double> reference(n), result(n);
+        const auto dt_std = timeit([&]() {
+            for (std::size_t i = 0; i < n; ++i)
+                reference[i] = std::pow(bases[i], exps[i]);
+        });
+        const auto dt_squaring = timeit([&]() {
+            for (std::size_t i = 0; i < n; ++i)
+                result[i] = pow_squaring(bases[i], exps[i]);
+        });
+        const auto dt_branchless = timeit([&]() {
+            for (std::size_t i = 0; i < n; ++i)
+                result[i] = pow_branchless(bases[i], exps[i]);
+        });
+        const auto dt_many = timeit([&]() { pow_many(bases, exps, result); });
+
+        double error = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            error = std::max(error, std::abs(result[i] - reference[i]) / std::abs(reference[i]));
+        std::cout << std::setw(18) << name << std::setw(14) << dt_std
+            << std::setw(14) << dt_squaring << std::setw(14) << dt_branchless
+            << std::setw(14) << dt_many << std::setw(14) << std::setprecision(3) << error << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <algorithm>
+#include <execution>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "mapped_file.hpp"
+
+// Streaming evaluation: the points are consumed and the results are written in chunks
+// of fixed size, so the memory used does not depend on the number of points.
+// A source of points has to provide
+//   std::size_t size() const;
+//   const double* chunk(std::size_t begin, std::size_t count, double* buffer);
+// where chunk returns a pointer to the points begin, ..., begin + count - 1,
+// buffer (of size at least count) may be used to store them.
+
+// the uniform grid x_0, x_0 + h, ..., computed only when needed
+class GridPoints {
+public:
+    GridPoints(double x0, double xf, std::size_t n)
+        : m_x0(x0), m_h(n > 1 ? (xf - x0) / (n - 1) : 0.0), m_n(n) {}
+
+    std::size_t size() const { return m_n; }
+
+    const double* chunk(std::size_t begin, std::size_t count, double* buffer) {
+        for (std::size_t i = 0; i < count; ++i)
+            buffer[i] = m_x0 + (begin + i) * m_h;
+        return buffer;
+    }
+
+private:
+    const double m_x0, m_h;
+    const std::size_t m_n;
+};
+
+// points stored as raw doubles in a binary file, read through a memory mapping
+class FilePoints {
+public:
+    explicit FilePoints(const std::string& filename) : m_file(filename) {
+        // a truncated file would silently lose its last point
+        if (m_file.size() % sizeof(double) != 0)
+            throw std::runtime_error(filename + ": the size is not a multiple of sizeof(double)");
+        m_file.advise_sequential();
+    }
+
+    std::size_t size() const { return m_file.size() / sizeof(double); }
+
+    const double* chunk(std::size_t begin, std::size_t, double*) {
+        // the previous chunks have already been evaluated, we do not need them in memory
+        m_file.release(begin * sizeof(double));
+        return reinterpret_cast<const double*>(m_file.data()) + begin;
+    }
+
+private:
+    MappedFile m_file;
+};
+
+// Writes the results to a binary file while the next chunk is being computed:
+// we fill one buffer while the other one is written to disk by another thread
+class DoubleBufferedWriter {
+public:
+    DoubleBufferedWriter(const std::string& filename, std::size_t chunk_size)
+        : m_out(filename, std::ios::out | std::ios::binary),
+        m_buffers{ std::vector<double>(chunk_size), std::vector<double>(chunk_size) } {
+        if (!m_out)
+            throw std::system_error(errno, std::generic_category(), filename);
+    }
+
+    // the buffer to fill with the next chunk of results
+    double* buffer() { return m_buffers[m_current].data(); }
+
+    // start writing the first 'count' values of the current buffer and switch buffer
+    void commit(std::size_t count) {
+        // the other buffer must be written before we start filling it
+        wait();
+        const auto* data = m_buffers[m_current].data();
+        m_pending = std::async(std::launch::async, [this, data, count]() {
+            m_out.write(reinterpret_cast<const char*>(data), count * sizeof(double));
+            if (!m_out)
+                throw std::runtime_error("error while writing the results");
+        });
+        m_current = 1 - m_current;
+    }
+
+    // wait for the last write to end, rethrows its errors
+    void wait() {
+        if (m_pending.valid())
+            m_pending.get();
+    }
+
+    ~DoubleBufferedWriter() {
+        // a destructor must not throw, errors are reported only by wait()
+        if (m_pending.valid())
+            m_pending.wait();
+    }
+
+private:
+    std::ofstream m_out;
+    std::vector<double> m_buffers[2];
+    unsigned int m_current = 0;
+    std::future<void> m_pending;
+};
+
+// evaluate the polynomial on all the points of the source and write the results to 'filename',
+// with at most 'chunk_size' points in memory at the same time
+template<typename Method, typename Points>
+void evaluate_poly_stream(Points& points,
+    const std::vector<double>& a,
+    const std::string& filename,
+    std::size_t chunk_size,
+    bool parallel) {
+    // with no points per chunk the loop would never advance
+    if (chunk_size == 0)
+        throw std::invalid_argument("evaluate_poly_stream: chunk_size must be positive");
+    DoubleBufferedWriter writer(filename, chunk_size);
+    std::vector<double> buffer(chunk_size);
+    const auto compute = [&a](double x) { return Method{}(a, x); };
+    for (std::size_t begin = 0; begin < points.size(); begin += chunk_size) {
+        const auto count = std::min(chunk_size, points.size() - begin);
+        const auto* x = points.chunk(begin, count, buffer.data());
+        if (parallel) {
+            std::transform(std::execution::par, x, x + count, writer.buffer(), compute);
+        }
+        else {
+            std::transform(x, x + count, writer.buffer(), compute);
+        }
+        writer.commit(count);
+    }
+    writer.wait();
+}
+
+#endif /* STREAM_H */
@@ -0,0 +1,198 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// how the iterations of parallel_for are split among the threads
+enum class schedule {
+    // thread t always gets the t-th contiguous block of the same size, so in repeated calls
+    // the same thread touches the same memory
+    static_blocks,
+    // the threads take chunks of decreasing size from a shared counter, better when
+    // the iterations have different cost
+    guided
+};
+
+// A fixed set of threads created once and reused by every parallel_for.
+// With pin = true thread t runs only on the t-th of the CPUs the process is allowed to use
+// (see taskset), in this way the memory it touches first is allocated on its NUMA node
+// and stays close to it. Only Linux lets us choose the CPUs, elsewhere pin does nothing.
+class ThreadPool {
+public:
+    // hardware_concurrency() is 0 when it is not known, the pool has at least one thread
+    explicit ThreadPool(unsigned int n_threads = std::thread::hardware_concurrency(), bool pin = false)
+        : m_n_threads(std::max(1u, n_threads)) {
+        for (unsigned int t = 0; t < m_n_threads; ++t)
+            m_workers.emplace_back([this, t]() { work(t); });
+        if (!pin)
+            return;
+        try {
+            pin_threads();
+        }
+        catch (...) {
+            // the destructor is not called if the constructor throws
+            stop();
+            throw;
+        }
+    }
+
+    // the threads own resources, the pool cannot be copied
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() { stop(); }
+
+    unsigned int size() const { return m_n_threads; }
+
+    // call job(t) on every thread t = 0, ..., size() - 1 and wait for all of them,
+    // the job must not throw
+    void run(const std::function<void(unsigned int)>& job) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_pending = m_n_threads;
+        ++m_generation;
+        m_start.notify_all();
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        m_job = nullptr;
+    }
+
+    // call f(begin, end) on disjoint ranges that cover [0, n), guided chunks have
+    // at least min_chunk iterations
+    void parallel_for(std::size_t n,
+        const std::function<void(std::size_t, std::size_t)>& f,
+        schedule s = schedule::static_blocks,
+        std::size_t min_chunk = 1024) {
+        const std::size_t T = m_n_threads;
+        if (s == schedule::static_blocks) {
+            run([&](unsigned int t) {
+                const auto begin = n * t / T, end = n * (t + 1) / T;
+                if (begin < end)
+                    f(begin, end);
+            });
+            return;
+        }
+        std::atomic<std::size_t> next{ 0 };
+        run([&](unsigned int) {
+            auto begin = next.load();
+            while (begin < n) {
+                const auto chunk = std::max(min_chunk, (n - begin) / (2 * T));
+                const auto end = std::min(n, begin + chunk);
+                // on failure 'begin' is updated with the current value of the counter
+                if (next.compare_exchange_weak(begin, end)) {
+                    f(begin, end);
+                    begin = next.load();
+                }
+            }
+        });
+    }
+
+private:
+#ifdef __linux__
+    // thread t runs only on the t-th CPU of the affinity mask of the process, the threads
+    // are waiting for a job so they are moved before touching any memory
+    void pin_threads() {
+        const auto cpus = allowed_cpus();
+        for (unsigned int t = 0; t < m_n_threads; ++t) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus[t % cpus.size()], &set);
+            const int err = pthread_setaffinity_np(m_workers[t].native_handle(), sizeof(cpu_set_t), &set);
+            if (err != 0)
+                throw std::system_error(err, std::generic_category(), "pthread_setaffinity_np");
+        }
+    }
+
+    // the CPUs in the affinity mask of the process
+    static std::vector<int> allowed_cpus() {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0)
+            throw std::system_error(errno, std::generic_category(), "sched_getaffinity");
+        std::vector<int> cpus;
+        for (int c = 0; c < CPU_SETSIZE; ++c)
+            if (CPU_ISSET(c, &set))
+                cpus.push_back(c);
+        return cpus;
+    }
+#else
+    void pin_threads() {}
+#endif
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& w : m_workers)
+            w.join();
+    }
+
+    void work(unsigned int t) {
+        std::size_t generation = 0;
+        while (true) {
+            const std::function<void(unsigned int)>* job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start.wait(lock, [&]() { return m_stop || m_generation != generation; });
+                if (m_stop)
+                    return;
+                generation = m_generation;
+                job = m_job;
+            }
+            (*job)(t);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_pending == 0)
+                    m_done.notify_one();
+            }
+        }
+    }
+
+    const unsigned int m_n_threads;
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_start, m_done;
+    const std::function<void(unsigned int)>* m_job = nullptr;
+    std::size_t m_generation = 0;
+    unsigned int m_pending = 0;
+    bool m_stop = false;
+};
+
+// allocator that leaves the elements uninitialized: a std::vector using it does not
+// write its memory when it is created, so each page is touched first by the thread
+// that computes the values stored in it
+template<typename T>
+struct default_init_allocator : std::allocator<T> {
+    template<typename U>
+    struct rebind { using other = default_init_allocator<U>; };
+
+    default_init_allocator() = default;
+    template<typename U>
+    default_init_allocator(const default_init_allocator<U>&) noexcept {}
+
+    template<typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(p)) U;
+    }
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,195 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware performance counters around a function, like timeit but also counting
+// cycles, instructions, branch misses and cache misses with Linux perf_event_open.
+// Counters that cannot be opened (no PMU in a virtual machine, perf_event_paranoid
+// too high, ...) are simply missing from the result, and without counters only the
+// time is reported, as on the systems other than Linux. Only user space is counted,
+// which works with perf_event_paranoid <= 2.
+namespace perf {
+  enum event { cycles, instructions, branches, branch_misses, l1d_loads, l1d_misses, llc_loads, llc_misses, n_events };
+
+  struct Result {
+    double ms = 0;
+    std::array<std::optional<uint64_t>, n_events> counts;
+
+    // a / b if both counters are there
+    std::optional<double> ratio(event a, event b) const {
+      if (!counts[a] || !counts[b] || *counts[b] == 0)
+        return std::nullopt;
+      return double(*counts[a]) / *counts[b];
+    }
+
+    void print(const std::string& name, std::ostream& os = std::cout) const {
+      const auto field = [&os](const char* label, std::optional<double> v, double scale, const char* unit) {
+        os << "  " << label << " ";
+        if (v)
+          os << std::fixed << std::setprecision(2) << *v * scale << unit;
+        else
+          os << "n/a";
+      };
+      const auto flags = os.flags();
+      const auto precision = os.precision();
+      os << name << ": " << std::fixed << std::setprecision(2) << ms << " [ms]";
+      field("IPC", ratio(instructions, cycles), 1, "");
+      field("branch misses", ratio(branch_misses, branches), 100, "%");
+      field("L1d misses", ratio(l1d_misses, l1d_loads), 100, "%");
+      field("LLC misses", ratio(llc_misses, llc_loads), 100, "%");
+      os << std::endl;
+      os.flags(flags);
+      os.precision(precision);
+    }
+  };
+
+  // elapsed time of f in milliseconds
+  inline double time_ms(const std::function<void()>& f) {
+    using namespace std::chrono;
+    const auto t0 = high_resolution_clock::now();
+    f();
+    const auto t1 = high_resolution_clock::now();
+    return duration_cast<nanoseconds>(t1 - t0).count() / 1e6;
+  }
+
+#ifdef __linux__
+  // The counters are opened once and reused by every measurement. They form a single
+  // group, so the kernel schedules them together and they all count in the same time
+  // window even when it has to multiplex them with other events, and they are read at
+  // once from the group leader. A group must fit in the hardware counters: the events
+  // go in pairs (the two terms of a ratio) and a pair that does not fit is left out.
+  // Counters count only the calling thread, not the threads it starts.
+  class Counters {
+  public:
+    Counters() {
+      constexpr auto l1d = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8);
+      const std::array<std::pair<uint32_t, uint64_t>, n_events> config = { {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE, l1d | (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16) },
+        { PERF_TYPE_HW_CACHE, l1d | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+      } };
+      const auto open = [&](int e) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = config[e].first;
+        attr.config = config[e].second;
+        // only the leader is enabled and disabled, the others follow it
+        attr.disabled = m_leader < 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // if the kernel multiplexes the group with other events, the enabled and
+        // running times are used to scale the counts
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, m_leader, 0));
+      };
+      for (int e = 0; e < n_events; e += 2) {
+        const int first = open(e);
+        if (first < 0)
+          continue;
+        if (m_leader < 0)
+          m_leader = first;
+        const int second = open(e + 1);
+        if (second < 0) {
+          // the leader can not be removed, it is simply not reported
+          if (first != m_leader)
+            close(first);
+          continue;
+        }
+        m_fd.push_back(first);
+        m_fd.push_back(second);
+        m_events.push_back(static_cast<event>(e));
+        m_events.push_back(static_cast<event>(e + 1));
+      }
+    }
+    Counters(const Counters&) = delete;
+    Counters& operator=(const Counters&) = delete;
+    ~Counters() {
+      // the leader is closed last
+      for (const auto fd : m_fd)
+        if (fd != m_leader)
+          close(fd);
+      if (m_leader >= 0)
+        close(m_leader);
+    }
+
+    // true if at least one counter is there
+    bool available() const { return !m_events.empty(); }
+
+    Result measure(const std::function<void()>& f) const {
+      if (available()) {
+        ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      }
+      Result result;
+      result.ms = time_ms(f);
+      if (available())
+        ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+      if (!available())
+        return result;
+      // number of events, time enabled, time running, then the values in the order the
+      // events were added to the group, starting from the leader
+      std::array<uint64_t, 3 + n_events> values;
+      const auto size = read(m_leader, values.data(), sizeof(values));
+      if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)) || values[2] == 0)
+        return result;
+      // the leader is not in m_fd if its pair did not fit
+      const std::size_t skip = m_fd.empty() || m_fd.front() != m_leader ? 1 : 0;
+      if (values[0] != skip + m_events.size())
+        return result;
+      for (std::size_t i = 0; i < m_events.size(); ++i)
+        result.counts[m_events[i]] = static_cast<uint64_t>(double(values[3 + skip + i]) * values[1] / values[2]);
+      return result;
+    }
+
+  private:
+    int m_leader = -1;
+    // the counters in the group and their events, in the order they were opened
+    std::vector<int> m_fd;
+    std::vector<event> m_events;
+  };
+#else
+  // perf_event_open is Linux only, here there are no counters
+  class Counters {
+  public:
+    bool available() const { return false; }
+
+    Result measure(const std::function<void()>& f) const {
+      Result result;
+      result.ms = time_ms(f);
+      return result;
+    }
+  };
+#endif
+}
+
+// like timeit, but returns the counters too
+inline perf::Result perfit(const std::function<void()>& f) {
+  static const perf::Counters counters;
+  return counters.measure(f);
+}
+
+#endif /* PERF_H */
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "perf.hpp"
+
+// the functions of the exercise, smaller.cpp is left as it is so that its assembly can be
+// read with g++ smaller.cpp -S; its main is exercise::main here and it is not used
+namespace exercise {
+#include "smaller.cpp"
+}
+
+// sum of the smaller element of every pair, with random pairs the branch of
+// smaller_standard is taken half of the times at random
+int main() {
+  constexpr std::size_t n = 10000000;
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<int> distrib(0, 1000);
+  std::vector<int> a(n), b(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = distrib(engine);
+    b[i] = distrib(engine);
+  }
+  // the same pairs ordered by the outcome of the comparison, the branch is predictable
+  std::vector<std::size_t> idx(n);
+  std::iota(idx.begin(), idx.end(), 0);
+  std::stable_partition(idx.begin(), idx.end(), [&](std::size_t i) { return a[i] < b[i]; });
+  std::vector<int> a_sorted(n), b_sorted(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a_sorted[i] = a[idx[i]];
+    b_sorted[i] = b[idx[i]];
+  }
+
+  for (const auto& [name, func] : { std::make_pair("smaller_standard", exercise::smaller_standard),
+                                    std::make_pair("smaller_branchless", exercise::smaller_branchless) }) {
+    for (const auto& [input, x, y] : { std::tie("random", a, b), std::tie("sorted", a_sorted, b_sorted) }) {
+      long long sum = 0;
+      perfit([&, func = func]() {
+        for (std::size_t i = 0; i < n; ++i)
+          sum += func(x[i], y[i]);
+      }).print(std::string(name) + " " + input);
+      std::cout << "  sum " << sum << std::endl;
+    }
+  }
+  return 0;
+}
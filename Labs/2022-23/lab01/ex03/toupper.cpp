@@ -2,6 +2,19 @@
 #include <chrono>
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <span>
+#include <string_view>
+#include <iomanip>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "perf.hpp"
 
 void toupper_standard(char* d, int len) {
   for (int i = 0; i < len; ++i) {
@@ -16,6 +29,250 @@ void toupper_branchless(char* d, int len) {
   }
 }
 
+// SIMD kernels. A byte x is in [Lo, Hi] iff (unsigned char)(x - Lo) <= Hi - Lo, so
+// every range check is a subtraction and a comparison on a whole register.
+// Every kernel shifts the bytes in [Lo, Hi] by -Delta: toupper is ['a', 'z'] and 32,
+// tolower is ['A', 'Z'] and -32.
+template<char Lo, char Hi, char Delta>
+void shift_range_scalar(char* d, int len) {
+  for (int i = 0; i < len; ++i)
+    d[i] -= Delta * (static_cast<unsigned char>(d[i] - Lo) <= Hi - Lo);
+}
+
+// true if all the characters are ASCII letters or digits: x | 0x20 maps the upper
+// case letters to the lower case ones (and no other byte to a letter)
+bool all_alnum_scalar(const char* d, int len) {
+  for (int i = 0; i < len; ++i) {
+    const bool digit = static_cast<unsigned char>(d[i] - '0') <= 9;
+    const bool letter = static_cast<unsigned char>((d[i] | 0x20) - 'a') <= 'z' - 'a';
+    if (!digit && !letter)
+      return false;
+  }
+  return true;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// SSE2 (and AVX2) only compare signed bytes: x - Lo - 128 moves the range to the
+// bottom of the signed bytes, where a signed x - Lo - 128 < Hi - Lo + 1 - 128 checks it.
+// Strings shorter than a register go to the scalar loop. The last register may
+// overlap the previous one, that is fine because a shifted byte is not in the
+// range anymore (the shift is longer than the range).
+template<char Lo, char Hi, char Delta>
+__attribute__((target("sse2")))
+void shift_range_sse2(char* d, int len) {
+  static_assert(Delta > Hi - Lo || -Delta > Hi - Lo, "the kernel is not idempotent");
+  constexpr int W = 16;
+  if (len < W)
+    return shift_range_scalar<Lo, Hi, Delta>(d, len);
+  const auto offset = _mm_set1_epi8(static_cast<char>(Lo + 128));
+  const auto bound = _mm_set1_epi8(static_cast<char>(Hi - Lo + 1 - 128));
+  const auto delta = _mm_set1_epi8(Delta);
+  for (int i = 0; ; i += W) {
+    if (i + W > len)
+      i = len - W;
+    auto p = reinterpret_cast<__m128i*>(d + i);
+    const auto x = _mm_loadu_si128(p);
+    const auto in = _mm_cmplt_epi8(_mm_sub_epi8(x, offset), bound);
+    _mm_storeu_si128(p, _mm_sub_epi8(x, _mm_and_si128(in, delta)));
+    if (i + W == len)
+      break;
+  }
+}
+
+template<char Lo, char Hi, char Delta>
+__attribute__((target("avx2")))
+void shift_range_avx2(char* d, int len) {
+  constexpr int W = 32;
+  if (len < W)
+    return shift_range_sse2<Lo, Hi, Delta>(d, len);
+  const auto offset = _mm256_set1_epi8(static_cast<char>(Lo + 128));
+  const auto bound = _mm256_set1_epi8(static_cast<char>(Hi - Lo + 1 - 128));
+  const auto delta = _mm256_set1_epi8(Delta);
+  for (int i = 0; ; i += W) {
+    if (i + W > len)
+      i = len - W;
+    auto p = reinterpret_cast<__m256i*>(d + i);
+    const auto x = _mm256_loadu_si256(p);
+    const auto in = _mm256_cmpgt_epi8(bound, _mm256_sub_epi8(x, offset));
+    _mm256_storeu_si256(p, _mm256_sub_epi8(x, _mm256_and_si256(in, delta)));
+    if (i + W == len)
+      break;
+  }
+}
+
+// AVX-512BW has unsigned comparisons into mask registers, and masked loads and stores
+// handle the tail: the bytes after the end of the string are never touched
+template<char Lo, char Hi, char Delta>
+__attribute__((target("avx512bw")))
+void shift_range_avx512(char* d, int len) {
+  constexpr int W = 64;
+  const auto lo = _mm512_set1_epi8(Lo);
+  const auto range = _mm512_set1_epi8(Hi - Lo);
+  const auto delta = _mm512_set1_epi8(Delta);
+  for (int i = 0; i < len; i += W) {
+    const __mmask64 valid = len - i >= W ? ~0ull : (1ull << (len - i)) - 1;
+    const auto x = _mm512_maskz_loadu_epi8(valid, d + i);
+    const auto in = _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, lo), range);
+    _mm512_mask_storeu_epi8(d + i, in & valid, _mm512_sub_epi8(x, delta));
+  }
+}
+
+__attribute__((target("sse2")))
+bool all_alnum_sse2(const char* d, int len) {
+  constexpr int W = 16;
+  if (len < W)
+    return all_alnum_scalar(d, len);
+  const auto digit_offset = _mm_set1_epi8(static_cast<char>('0' + 128));
+  const auto digit_bound = _mm_set1_epi8(static_cast<char>(10 - 128));
+  const auto letter_offset = _mm_set1_epi8(static_cast<char>('a' + 128));
+  const auto letter_bound = _mm_set1_epi8(static_cast<char>(26 - 128));
+  const auto case_bit = _mm_set1_epi8(0x20);
+  for (int i = 0; ; i += W) {
+    if (i + W > len)
+      i = len - W;
+    const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+    const auto digit = _mm_cmplt_epi8(_mm_sub_epi8(x, digit_offset), digit_bound);
+    const auto letter = _mm_cmplt_epi8(_mm_sub_epi8(_mm_or_si128(x, case_bit), letter_offset), letter_bound);
+    if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF)
+      return false;
+    if (i + W == len)
+      return true;
+  }
+}
+
+__attribute__((target("avx2")))
+bool all_alnum_avx2(const char* d, int len) {
+  constexpr int W = 32;
+  if (len < W)
+    return all_alnum_sse2(d, len);
+  const auto digit_offset = _mm256_set1_epi8(static_cast<char>('0' + 128));
+  const auto digit_bound = _mm256_set1_epi8(static_cast<char>(10 - 128));
+  const auto letter_offset = _mm256_set1_epi8(static_cast<char>('a' + 128));
+  const auto letter_bound = _mm256_set1_epi8(static_cast<char>(26 - 128));
+  const auto case_bit = _mm256_set1_epi8(0x20);
+  for (int i = 0; ; i += W) {
+    if (i + W > len)
+      i = len - W;
+    const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d + i));
+    const auto digit = _mm256_cmpgt_epi8(digit_bound, _mm256_sub_epi8(x, digit_offset));
+    const auto letter = _mm256_cmpgt_epi8(letter_bound, _mm256_sub_epi8(_mm256_or_si256(x, case_bit), letter_offset));
+    if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1)
+      return false;
+    if (i + W == len)
+      return true;
+  }
+}
+
+__attribute__((target("avx512bw")))
+bool all_alnum_avx512(const char* d, int len) {
+  constexpr int W = 64;
+  const auto zero = _mm512_set1_epi8('0');
+  const auto nine = _mm512_set1_epi8(9);
+  const auto a = _mm512_set1_epi8('a');
+  const auto z = _mm512_set1_epi8('z' - 'a');
+  const auto case_bit = _mm512_set1_epi8(0x20);
+  for (int i = 0; i < len; i += W) {
+    const __mmask64 valid = len - i >= W ? ~0ull : (1ull << (len - i)) - 1;
+    const auto x = _mm512_maskz_loadu_epi8(valid, d + i);
+    const auto digit = _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, zero), nine);
+    const auto letter = _mm512_cmple_epu8_mask(_mm512_sub_epi8(_mm512_or_si512(x, case_bit), a), z);
+    if (((digit | letter) & valid) != valid)
+      return false;
+  }
+  return true;
+}
+
+#endif
+
+// the kernels for the instruction set of the CPU we are running on, chosen once at startup
+struct AsciiKernels {
+  std::string name;
+  void (*toupper)(char*, int);
+  void (*tolower)(char*, int);
+  bool (*all_alnum)(const char*, int);
+};
+
+const AsciiKernels scalar_kernels{ "scalar", shift_range_scalar<'a', 'z', 32>, shift_range_scalar<'A', 'Z', -32>, all_alnum_scalar };
+#if defined(__x86_64__) || defined(__i386__)
+const AsciiKernels sse2_kernels{ "sse2", shift_range_sse2<'a', 'z', 32>, shift_range_sse2<'A', 'Z', -32>, all_alnum_sse2 };
+const AsciiKernels avx2_kernels{ "avx2", shift_range_avx2<'a', 'z', 32>, shift_range_avx2<'A', 'Z', -32>, all_alnum_avx2 };
+const AsciiKernels avx512_kernels{ "avx512", shift_range_avx512<'a', 'z', 32>, shift_range_avx512<'A', 'Z', -32>, all_alnum_avx512 };
+#endif
+
+// the kernels that run on this CPU, the best first; the SIMD kernels are only for x86,
+// where SSE2 is always there on x86-64 but not on 32 bit
+std::vector<AsciiKernels> supported_kernels() {
+  std::vector<AsciiKernels> kernels;
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512bw"))
+    kernels.push_back(avx512_kernels);
+  if (__builtin_cpu_supports("avx2"))
+    kernels.push_back(avx2_kernels);
+  if (__builtin_cpu_supports("sse2"))
+    kernels.push_back(sse2_kernels);
+#endif
+  kernels.push_back(scalar_kernels);
+  return kernels;
+}
+
+AsciiKernels select_kernels() { return supported_kernels().front(); }
+
+const AsciiKernels ascii = select_kernels();
+
+void toupper_simd(char* d, int len) { ascii.toupper(d, len); }
+void tolower_simd(char* d, int len) { ascii.tolower(d, len); }
+bool all_alnum(const char* d, int len) { return ascii.all_alnum(d, len); }
+
+// many short strings stored one after the other in a single buffer: the i-th string
+// is bytes[offsets[i], offsets[i + 1]). Compared to a vector of vectors there is one
+// allocation instead of one per string and the strings are contiguous in memory.
+class StringPool {
+public:
+  StringPool() : m_offsets{ 0 } {}
+
+  void reserve(std::size_t n_strings, std::size_t n_bytes) {
+    m_offsets.reserve(n_strings + 1);
+    m_bytes.reserve(n_bytes);
+  }
+
+  void push_back(std::string_view s) {
+    m_bytes.insert(m_bytes.end(), s.begin(), s.end());
+    m_offsets.push_back(m_bytes.size());
+  }
+
+  std::size_t size() const { return m_offsets.size() - 1; }
+  std::span<char> operator[](std::size_t i) {
+    return { m_bytes.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i] };
+  }
+  std::string_view operator[](std::size_t i) const {
+    return { m_bytes.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i] };
+  }
+  // all the characters, e.g. to save and restore the content; a span and not the vector,
+  // so that the size and the offsets of the strings can not be changed
+  std::span<char> bytes() { return m_bytes; }
+  std::span<const char> bytes() const { return m_bytes; }
+
+  // iterates over the strings as spans, the strings can be modified in place
+  class iterator {
+  public:
+    iterator(StringPool* pool, std::size_t i) : m_pool(pool), m_i(i) {}
+    std::span<char> operator*() const { return (*m_pool)[m_i]; }
+    iterator& operator++() { ++m_i; return *this; }
+    bool operator==(const iterator& other) const { return m_i == other.m_i; }
+  private:
+    StringPool* m_pool;
+    std::size_t m_i;
+  };
+  iterator begin() { return { this, 0 }; }
+  iterator end() { return { this, size() }; }
+
+private:
+  std::vector<char> m_bytes;
+  std::vector<std::size_t> m_offsets;
+};
+
 static constexpr char alphanum[] =
 "0123456789"
 "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -27,7 +284,7 @@ int main() {
 
   const unsigned int num_test = 100000;
   std::uniform_int_distribution<> len_distrib(5, 50);
-  std::uniform_int_distribution<> chr_distrib(0, 62); // all alphanum ascii characters 
+  std::uniform_int_distribution<> chr_distrib(0, 61); // all alphanum ascii characters 
 
   // build tests
   std::vector<std::vector<char>> tests;
@@ -42,16 +299,111 @@ int main() {
     tests.push_back(tmp);
   }
 
+  // check the kernels against the scalar versions, on the tests and on strings of
+  // every byte value and of every length up to two AVX-512 registers
+  std::vector<std::vector<char>> checks = tests;
+  for (int len = 0; len <= 128; ++len) {
+    std::vector<char> all_bytes(len), alnum_only(len);
+    for (int i = 0; i < len; ++i) {
+      all_bytes[i] = static_cast<char>(i * 37 + len);
+      alnum_only[i] = alphanum[(i * 7 + len) % 62];
+    }
+    checks.push_back(all_bytes);
+    checks.push_back(alnum_only);
+  }
+  for (const auto& k : supported_kernels()) {
+    bool ok = true;
+    for (const auto& t : checks) {
+      // from the second character the string is not aligned anymore
+      const int head = t.size() % 2;
+      const int len = t.size() - head;
+      for (const auto& [kernel, reference] : { std::make_pair(k.toupper, shift_range_scalar<'a', 'z', 32>),
+                                              std::make_pair(k.tolower, shift_range_scalar<'A', 'Z', -32>) }) {
+        auto a = t, b = t;
+        kernel(a.data() + head, len);
+        reference(b.data() + head, len);
+        ok = ok && a == b;
+      }
+      ok = ok && k.all_alnum(t.data() + head, len) == all_alnum_scalar(t.data() + head, len);
+    }
+    std::cout << k.name << " kernels test: " << (ok ? "PASSED" : "FAILED") << std::endl;
+  }
+  std::cout << "Selected kernels: " << ascii.name << std::endl;
+
   // run tests
-  for (const auto& func : { toupper_branchless, toupper_standard }) {
+  std::size_t bytes = 0;
+  for (const auto& t : tests)
+    bytes += t.size();
+  StringPool pool;
+  pool.reserve(tests.size(), bytes);
+  for (const auto& t : tests)
+    pool.push_back({ t.data(), t.size() });
+  const auto pristine_tests = tests;
+  const std::vector<char> pristine_pool(pool.bytes().begin(), pool.bytes().end());
+
+  const auto gb_per_s = [bytes](const std::function<void()>& f) {
     using namespace std::chrono;
     const auto t0 = high_resolution_clock::now();
-    for (auto t : tests)
-      func(t.data(), t.size());
+    f();
     const auto t1 = high_resolution_clock::now();
-    const auto dt = duration_cast<microseconds>(t1 - t0).count();
-    std::cout << "Elapsed: " << dt << " [μs]" << std::endl;
+    return double(bytes) / duration_cast<nanoseconds>(t1 - t0).count();
+  };
+  const std::vector<std::pair<std::string, void (*)(char*, int)>> functions = {
+    { "toupper_branchless", toupper_branchless },
+    { "toupper_standard", toupper_standard },
+    { "toupper_simd", toupper_simd },
+    { "tolower_simd", tolower_simd },
+  };
+  // the first column is the old harness, that copies every string at every pass
+  std::cout << std::setw(20) << "[GB/s]" << std::setw(14) << "copies" << std::setw(14) << "in place"
+    << std::setw(14) << "string pool" << std::setw(14) << "whole pool" << std::endl;
+  for (const auto& [name, func] : functions) {
+    const auto copies = gb_per_s([&, func = func]() {
+      for (auto t : tests)
+        func(t.data(), t.size());
+    });
+    // the input is restored before each run, so that every run sees the same data
+    tests = pristine_tests;
+    const auto in_place = gb_per_s([&, func = func]() {
+      for (auto& t : tests)
+        func(t.data(), t.size());
+    });
+    tests = pristine_tests;
+    std::ranges::copy(pristine_pool, pool.bytes().begin());
+    const auto flat = gb_per_s([&, func = func]() {
+      for (auto s : pool)
+        func(s.data(), s.size());
+    });
+    // a per character transform can also run on all the strings with a single call
+    std::ranges::copy(pristine_pool, pool.bytes().begin());
+    const auto whole = gb_per_s([&, func = func]() { func(pool.bytes().data(), pool.bytes().size()); });
+    std::cout << std::setw(20) << name << std::setw(14) << copies << std::setw(14) << in_place
+      << std::setw(14) << flat << std::setw(14) << whole << std::endl;
+  }
+  std::ranges::copy(pristine_pool, pool.bytes().begin());
+
+  // the counters show where the time goes: the standard version mispredicts the
+  // branch on the random letters, the others do not branch on the data
+  for (const auto& [name, func] : functions) {
+    std::ranges::copy(pristine_pool, pool.bytes().begin());
+    perfit([&, func = func]() {
+      for (auto s : pool)
+        func(s.data(), s.size());
+    }).print(name);
+  }
+  std::ranges::copy(pristine_pool, pool.bytes().begin());
+
+  for (const auto& [name, func] : { std::make_pair("all_alnum_scalar", all_alnum_scalar),
+                                    std::make_pair("all_alnum", all_alnum) }) {
+    using namespace std::chrono;
+    unsigned int count = 0;
+    const auto t0 = high_resolution_clock::now();
+    for (const auto s : pool)
+      count += func(s.data(), s.size());
+    const auto t1 = high_resolution_clock::now();
+    const auto dt = duration_cast<nanoseconds>(t1 - t0).count();
+    std::cout << name << ": " << double(bytes) / dt << " [GB/s] (" << count << " alphanumeric)" << std::endl;
   }
 
   return 0;
-}
\ No newline at end of file
+}
@@ -6,24 +6,24 @@
 	.weak	_ZNKSt5ctypeIcE8do_widenEc
 	.type	_ZNKSt5ctypeIcE8do_widenEc, @function
 _ZNKSt5ctypeIcE8do_widenEc:
-.LFB3308:
+.LFB3636:
 	.cfi_startproc
 	movl	%esi, %eax
 	ret
 	.cfi_endproc
-.LFE3308:
+.LFE3636:
 	.size	_ZNKSt5ctypeIcE8do_widenEc, .-_ZNKSt5ctypeIcE8do_widenEc
 	.text
 	.p2align 4
 	.globl	_Z16toupper_standardPci
 	.type	_Z16toupper_standardPci, @function
 _Z16toupper_standardPci:
-.LFB3555:
+.LFB12529:
 	.cfi_startproc
 	testl	%esi, %esi
 	jle	.L3
-	leal	-1(%rsi), %eax
-	leaq	1(%rdi,%rax), %rcx
+	movslq	%esi, %rsi
+	leaq	(%rdi,%rsi), %rcx
 	.p2align 4,,10
 	.p2align 3
 .L6:
@@ -35,18 +35,18 @@ _Z16toupper_standardPci:
 	movb	%al, (%rdi)
 .L5:
 	addq	$1, %rdi
-	cmpq	%rcx, %rdi
+	cmpq	%rdi, %rcx
 	jne	.L6
 .L3:
 	ret
 	.cfi_endproc
-.LFE3555:
+.LFE12529:
 	.size	_Z16toupper_standardPci, .-_Z16toupper_standardPci
 	.p2align 4
 	.globl	_Z18toupper_branchlessPci
 	.type	_Z18toupper_branchlessPci, @function
 _Z18toupper_branchlessPci:
-.LFB3556:
+.LFB12530:
 	.cfi_startproc
 	movq	%rdi, %rcx
 	movl	%esi, %edx
@@ -59,11 +59,10 @@ _Z18toupper_branchlessPci:
 	movq	%rdi, %rax
 	pxor	%xmm2, %xmm2
 	movdqa	.LC0(%rip), %xmm5
-	subl	$1, %esi
+	salq	$4, %rsi
 	movdqa	.LC1(%rip), %xmm4
 	movdqa	.LC2(%rip), %xmm3
-	salq	$4, %rsi
-	leaq	16(%rdi,%rsi), %rsi
+	addq	%rdi, %rsi
 	.p2align 4,,10
 	.p2align 3
 .L11:
@@ -268,380 +267,5934 @@ _Z18toupper_branchlessPci:
 .L15:
 	ret
 	.cfi_endproc
-.LFE3556:
+.LFE12530:
 	.size	_Z18toupper_branchlessPci, .-_Z18toupper_branchlessPci
-	.section	.text._ZNSt13random_deviceC2Ev,"axG",@progbits,_ZNSt13random_deviceC5Ev,comdat
-	.align 2
-	.p2align 4
-	.weak	_ZNSt13random_deviceC2Ev
-	.type	_ZNSt13random_deviceC2Ev, @function
-_ZNSt13random_deviceC2Ev:
-.LFB2242:
-	.cfi_startproc
-	.cfi_personality 0x3,__gxx_personality_v0
-	.cfi_lsda 0x3,.LLSDA2242
-	pushq	%rbp
-	.cfi_def_cfa_offset 16
-	.cfi_offset 6, -16
-	movl	$27765, %eax
-	pushq	%rbx
-	.cfi_def_cfa_offset 24
-	.cfi_offset 3, -24
-	subq	$40, %rsp
-	.cfi_def_cfa_offset 64
-	leaq	16(%rsp), %rbx
-	movq	%rsp, %rsi
-	movw	%ax, 20(%rsp)
-	movq	%rbx, (%rsp)
-	movl	$1634100580, 16(%rsp)
-	movb	$116, 22(%rsp)
-	movq	$7, 8(%rsp)
-	movb	$0, 23(%rsp)
-.LEHB0:
-	call	_ZNSt13random_device7_M_initERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE
-.LEHE0:
-	movq	(%rsp), %rdi
-	cmpq	%rbx, %rdi
-	je	.L16
-	movq	16(%rsp), %rax
-	leaq	1(%rax), %rsi
-	call	_ZdlPvm
-.L16:
-	addq	$40, %rsp
-	.cfi_remember_state
-	.cfi_def_cfa_offset 24
-	popq	%rbx
-	.cfi_def_cfa_offset 16
-	popq	%rbp
-	.cfi_def_cfa_offset 8
-	ret
-.L20:
-	.cfi_restore_state
-	movq	%rax, %rbp
-.L18:
-	movq	(%rsp), %rdi
-	cmpq	%rbx, %rdi
-	je	.L19
-	movq	16(%rsp), %rax
-	leaq	1(%rax), %rsi
-	call	_ZdlPvm
-.L19:
-	movq	%rbp, %rdi
-.LEHB1:
-	call	_Unwind_Resume
-.LEHE1:
-	.cfi_endproc
-.LFE2242:
-	.globl	__gxx_personality_v0
-	.section	.gcc_except_table._ZNSt13random_deviceC2Ev,"aG",@progbits,_ZNSt13random_deviceC5Ev,comdat
-.LLSDA2242:
-	.byte	0xff
-	.byte	0xff
-	.byte	0x1
-	.uleb128 .LLSDACSE2242-.LLSDACSB2242
-.LLSDACSB2242:
-	.uleb128 .LEHB0-.LFB2242
-	.uleb128 .LEHE0-.LEHB0
-	.uleb128 .L20-.LFB2242
-	.uleb128 0
-	.uleb128 .LEHB1-.LFB2242
-	.uleb128 .LEHE1-.LEHB1
-	.uleb128 0
-	.uleb128 0
-.LLSDACSE2242:
-	.section	.text._ZNSt13random_deviceC2Ev,"axG",@progbits,_ZNSt13random_deviceC5Ev,comdat
-	.size	_ZNSt13random_deviceC2Ev, .-_ZNSt13random_deviceC2Ev
-	.weak	_ZNSt13random_deviceC1Ev
-	.set	_ZNSt13random_deviceC1Ev,_ZNSt13random_deviceC2Ev
-	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EED5Ev,comdat
-	.align 2
 	.p2align 4
-	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
-	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev, @function
-_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev:
-.LFB3946:
+	.globl	_Z16all_alnum_scalarPKci
+	.type	_Z16all_alnum_scalarPKci, @function
+_Z16all_alnum_scalarPKci:
+.LFB12532:
 	.cfi_startproc
-	pushq	%r12
-	.cfi_def_cfa_offset 16
-	.cfi_offset 12, -16
-	movq	%rdi, %r12
-	pushq	%rbp
-	.cfi_def_cfa_offset 24
-	.cfi_offset 6, -24
-	pushq	%rbx
-	.cfi_def_cfa_offset 32
-	.cfi_offset 3, -32
-	movq	8(%rdi), %rbx
-	movq	(%rdi), %rbp
-	cmpq	%rbp, %rbx
-	je	.L23
-	.p2align 4,,10
-	.p2align 3
-.L27:
-	movq	0(%rbp), %rdi
-	testq	%rdi, %rdi
-	je	.L24
-	movq	16(%rbp), %rsi
-	addq	$24, %rbp
-	subq	%rdi, %rsi
-	call	_ZdlPvm
-	cmpq	%rbp, %rbx
-	jne	.L27
-.L26:
-	movq	(%r12), %rbp
-.L23:
-	testq	%rbp, %rbp
-	je	.L22
-	movq	16(%r12), %rsi
-	popq	%rbx
-	.cfi_remember_state
-	.cfi_def_cfa_offset 24
-	movq	%rbp, %rdi
-	subq	%rbp, %rsi
-	popq	%rbp
-	.cfi_def_cfa_offset 16
-	popq	%r12
-	.cfi_def_cfa_offset 8
-	jmp	_ZdlPvm
+	testl	%esi, %esi
+	jle	.L20
+	movslq	%esi, %rsi
+	leaq	(%rdi,%rsi), %rcx
+	jmp	.L19
 	.p2align 4,,10
 	.p2align 3
-.L24:
-	.cfi_restore_state
-	addq	$24, %rbp
-	cmpq	%rbp, %rbx
-	jne	.L27
-	jmp	.L26
+.L22:
+	addq	$1, %rdi
+	cmpq	%rdi, %rcx
+	je	.L20
+.L19:
+	movzbl	(%rdi), %edx
+	movl	%edx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	jbe	.L22
+	subl	$48, %edx
+	cmpb	$9, %dl
+	jbe	.L22
+	xorl	%eax, %eax
+	ret
 	.p2align 4,,10
 	.p2align 3
-.L22:
-	popq	%rbx
-	.cfi_def_cfa_offset 24
-	popq	%rbp
-	.cfi_def_cfa_offset 16
-	popq	%r12
-	.cfi_def_cfa_offset 8
+.L20:
+	movl	$1, %eax
 	ret
 	.cfi_endproc
-.LFE3946:
-	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
-	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
-	.set	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev,_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
-	.section	.rodata._ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_.str1.1,"aMS",@progbits,1
-.LC3:
-	.string	"vector::_M_realloc_insert"
-	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,comdat
-	.align 2
+.LFE12532:
+	.size	_Z16all_alnum_scalarPKci, .-_Z16all_alnum_scalarPKci
 	.p2align 4
-	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_
-	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_, @function
-_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_:
-.LFB4170:
+	.globl	_Z12toupper_simdPci
+	.type	_Z12toupper_simdPci, @function
+_Z12toupper_simdPci:
+.LFB12624:
 	.cfi_startproc
-	.cfi_personality 0x3,__gxx_personality_v0
-	.cfi_lsda 0x3,.LLSDA4170
-	pushq	%r15
-	.cfi_def_cfa_offset 16
-	.cfi_offset 15, -16
-	pushq	%r14
-	.cfi_def_cfa_offset 24
-	.cfi_offset 14, -24
-	pushq	%r13
-	.cfi_def_cfa_offset 32
-	.cfi_offset 13, -32
-	pushq	%r12
-	.cfi_def_cfa_offset 40
-	.cfi_offset 12, -40
-	pushq	%rbp
-	.cfi_def_cfa_offset 48
-	.cfi_offset 6, -48
-	pushq	%rbx
-	.cfi_def_cfa_offset 56
-	.cfi_offset 3, -56
-	subq	$56, %rsp
-	.cfi_def_cfa_offset 112
-	movq	8(%rdi), %rax
-	movq	(%rdi), %r13
-	movq	%rdx, 16(%rsp)
-	movabsq	$-6148914691236517205, %rdx
-	movq	%rax, 40(%rsp)
-	subq	%r13, %rax
-	sarq	$3, %rax
-	imulq	%rdx, %rax
-	movabsq	$384307168202282325, %rdx
-	cmpq	%rdx, %rax
-	je	.L82
-	testq	%rax, %rax
-	movl	$1, %edx
-	movq	%rsi, %r15
-	movq	%rdi, %r14
-	cmovne	%rax, %rdx
-	movq	%rsi, %rbp
-	movq	%rsi, %rbx
-	addq	%rdx, %rax
-	setc	%dl
-	movq	%rax, 8(%rsp)
-	subq	%r13, %r15
-	movzbl	%dl, %edx
-	testq	%rdx, %rdx
-	jne	.L55
-	testq	%rax, %rax
-	jne	.L35
-	xorl	%r12d, %r12d
-.L54:
-	movq	16(%rsp), %rdi
-	addq	%r12, %r15
-	pxor	%xmm0, %xmm0
-	movq	$0, 16(%r15)
-	movq	8(%rdi), %rax
-	subq	(%rdi), %rax
-	movups	%xmm0, (%r15)
-	movq	%rax, 32(%rsp)
-	je	.L36
-	js	.L83
-	movq	%rax, %rdi
-.LEHB2:
-	call	_Znwm
-.LEHE2:
-	movq	16(%rsp), %rdx
-	movq	%rax, %rcx
-	movq	%rax, %xmm0
-	movq	32(%rsp), %rax
-	punpcklqdq	%xmm0, %xmm0
-	movq	(%rdx), %rsi
-	movq	8(%rdx), %rdx
-	addq	%rcx, %rax
-	movups	%xmm0, (%r15)
-	movq	%rax, 16(%r15)
-	subq	%rsi, %rdx
-	jne	.L84
-.L38:
-	addq	%rdx, %rcx
-	movq	%rcx, 8(%r15)
-	cmpq	%r13, %rbp
-	je	.L57
-	leaq	-24(%rbp), %rcx
-	movq	%r13, %rax
-	movabsq	$768614336404564651, %rdx
-	subq	%r13, %rcx
-	shrq	$3, %rcx
-	imulq	%rdx, %rcx
-	movabsq	$2305843009213693951, %rdx
-	andq	%rdx, %rcx
-	movq	%r12, %rdx
-	subq	%r13, %rdx
-	subq	$8, %rdx
-	cmpq	$32, %rdx
-	jbe	.L58
-	testq	%rcx, %rcx
-	je	.L58
-	addq	$1, %rcx
-	movq	%r12, %rdx
-	movq	%rcx, %rsi
-	shrq	%rsi
-	leaq	(%rsi,%rsi,2), %rsi
+	jmp	*32+_ZL5ascii(%rip)
+	.cfi_endproc
+.LFE12624:
+	.size	_Z12toupper_simdPci, .-_Z12toupper_simdPci
+	.p2align 4
+	.globl	_Z12tolower_simdPci
+	.type	_Z12tolower_simdPci, @function
+_Z12tolower_simdPci:
+.LFB12625:
+	.cfi_startproc
+	jmp	*40+_ZL5ascii(%rip)
+	.cfi_endproc
+.LFE12625:
+	.size	_Z12tolower_simdPci, .-_Z12tolower_simdPci
+	.p2align 4
+	.globl	_Z9all_alnumPKci
+	.type	_Z9all_alnumPKci, @function
+_Z9all_alnumPKci:
+.LFB12626:
+	.cfi_startproc
+	jmp	*48+_ZL5ascii(%rip)
+	.cfi_endproc
+.LFE12626:
+	.size	_Z9all_alnumPKci, .-_Z9all_alnumPKci
+	.section	.text._Z18shift_range_scalarILc97ELc122ELc32EEvPci,"axG",@progbits,_Z18shift_range_scalarILc97ELc122ELc32EEvPci,comdat
+	.p2align 4
+	.weak	_Z18shift_range_scalarILc97ELc122ELc32EEvPci
+	.type	_Z18shift_range_scalarILc97ELc122ELc32EEvPci, @function
+_Z18shift_range_scalarILc97ELc122ELc32EEvPci:
+.LFB13337:
+	.cfi_startproc
+	movq	%rdi, %rcx
+	movl	%esi, %edx
+	testl	%esi, %esi
+	jle	.L30
+	leal	-1(%rsi), %eax
+	cmpl	$14, %eax
+	jbe	.L35
+	shrl	$4, %esi
+	movq	%rdi, %rax
+	pxor	%xmm2, %xmm2
+	movdqa	.LC0(%rip), %xmm5
 	salq	$4, %rsi
-	addq	%r13, %rsi
+	movdqa	.LC1(%rip), %xmm4
+	movdqa	.LC2(%rip), %xmm3
+	addq	%rdi, %rsi
 	.p2align 4,,10
 	.p2align 3
-.L41:
-	movdqu	(%rax), %xmm6
-	movdqu	16(%rax), %xmm7
-	addq	$48, %rax
-	addq	$48, %rdx
-	movdqu	-16(%rax), %xmm0
-	movups	%xmm6, -48(%rdx)
-	movups	%xmm7, -32(%rdx)
-	movups	%xmm0, -16(%rdx)
+.L33:
+	movdqu	(%rax), %xmm0
+	movdqu	(%rax), %xmm1
+	addq	$16, %rax
+	paddb	%xmm5, %xmm0
+	psubusb	%xmm4, %xmm0
+	pcmpeqb	%xmm2, %xmm0
+	pand	%xmm3, %xmm0
+	psubb	%xmm0, %xmm1
+	movups	%xmm1, -16(%rax)
 	cmpq	%rsi, %rax
-	jne	.L41
-	movq	%rcx, %rsi
-	andq	$-2, %rsi
-	leaq	(%rsi,%rsi,2), %rax
-	salq	$3, %rax
-	leaq	(%r12,%rax), %rdx
-	addq	%r13, %rax
-	cmpq	%rsi, %rcx
-	je	.L43
-	movdqu	(%rax), %xmm5
-	movq	16(%rax), %rax
-	movq	%rax, 16(%rdx)
-	movups	%xmm5, (%rdx)
-.L43:
-	leaq	(%rcx,%rcx,2), %rax
-	leaq	(%r12,%rax,8), %rsi
-.L39:
-	movq	40(%rsp), %rdi
-	addq	$24, %rsi
-	cmpq	%rdi, %rbp
-	je	.L44
-	movabsq	$768614336404564651, %rcx
-	subq	%rbp, %rdi
-	movq	%rbp, %rax
-	movq	%rdi, %rdx
-	subq	$24, %rdx
-	shrq	$3, %rdx
-	imulq	%rcx, %rdx
-	movabsq	$2305843009213693951, %rcx
-	andq	%rcx, %rdx
-	leaq	1(%rdx), %rdi
-	je	.L59
-	movq	%rdi, %rcx
-	movq	%rsi, %rdx
-	shrq	%rcx
-	leaq	(%rcx,%rcx,2), %rcx
-	salq	$4, %rcx
-	addq	%rbp, %rcx
-	.p2align 4,,10
-	.p2align 3
-.L46:
-	movdqu	(%rax), %xmm2
-	movdqu	16(%rax), %xmm3
-	addq	$48, %rax
-	addq	$48, %rdx
-	movdqu	-16(%rax), %xmm4
-	movups	%xmm2, -48(%rdx)
-	movups	%xmm3, -32(%rdx)
-	movups	%xmm4, -16(%rdx)
-	cmpq	%rax, %rcx
-	jne	.L46
-	movq	%rdi, %rdx
-	andq	$-2, %rdx
-	leaq	(%rdx,%rdx,2), %rbx
-	salq	$3, %rbx
-	leaq	(%rsi,%rbx), %rax
-	addq	%rbp, %rbx
-	cmpq	%rdx, %rdi
-	je	.L47
-.L45:
-	movq	16(%rbx), %rdx
-	movdqu	(%rbx), %xmm1
-	movq	%rdx, 16(%rax)
-	movups	%xmm1, (%rax)
-.L47:
-	leaq	(%rdi,%rdi,2), %rax
-	leaq	(%rsi,%rax,8), %rsi
-.L44:
-	movq	%r12, %xmm0
-	movq	%rsi, %xmm7
-	punpcklqdq	%xmm7, %xmm0
-	testq	%r13, %r13
-	je	.L48
-	movq	16(%r14), %rsi
-	movq	%r13, %rdi
-	movaps	%xmm0, 16(%rsp)
-	subq	%r13, %rsi
-	call	_ZdlPvm
-	movdqa	16(%rsp), %xmm0
-.L48:
-	addq	8(%rsp), %r12
-	movups	%xmm0, (%r14)
-	movq	%r12, 16(%r14)
-	addq	$56, %rsp
-	.cfi_remember_state
-	.cfi_def_cfa_offset 56
-	popq	%rbx
-	.cfi_def_cfa_offset 48
-	popq	%rbp
+	jne	.L33
+	movl	%edx, %eax
+	andl	$-16, %eax
+	testb	$15, %dl
+	je	.L37
+.L32:
+	movslq	%eax, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	1(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	2(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	3(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	4(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	5(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	6(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	7(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	8(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	9(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	10(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	11(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	12(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	13(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L30
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-97(%rdi), %r8d
+	cmpb	$25, %r8b
+	setbe	%r8b
+	addl	$14, %eax
+	sall	$5, %r8d
+	subl	%r8d, %edi
+	movb	%dil, (%rsi)
+	cmpl	%eax, %edx
+	jle	.L30
+	cltq
+	addq	%rax, %rcx
+	movzbl	(%rcx), %eax
+	leal	-97(%rax), %edx
+	cmpb	$25, %dl
+	setbe	%dl
+	sall	$5, %edx
+	subl	%edx, %eax
+	movb	%al, (%rcx)
+.L30:
+	ret
+.L35:
+	xorl	%eax, %eax
+	jmp	.L32
+.L37:
+	ret
+	.cfi_endproc
+.LFE13337:
+	.size	_Z18shift_range_scalarILc97ELc122ELc32EEvPci, .-_Z18shift_range_scalarILc97ELc122ELc32EEvPci
+	.section	.text._Z18shift_range_scalarILc65ELc90ELcn32EEvPci,"axG",@progbits,_Z18shift_range_scalarILc65ELc90ELcn32EEvPci,comdat
+	.p2align 4
+	.weak	_Z18shift_range_scalarILc65ELc90ELcn32EEvPci
+	.type	_Z18shift_range_scalarILc65ELc90ELcn32EEvPci, @function
+_Z18shift_range_scalarILc65ELc90ELcn32EEvPci:
+.LFB13338:
+	.cfi_startproc
+	movq	%rdi, %rcx
+	movl	%esi, %edx
+	testl	%esi, %esi
+	jle	.L38
+	leal	-1(%rsi), %eax
+	cmpl	$14, %eax
+	jbe	.L55
+	shrl	$4, %esi
+	movq	%rdi, %rax
+	pxor	%xmm3, %xmm3
+	movdqa	.LC3(%rip), %xmm6
+	salq	$4, %rsi
+	movdqa	.LC1(%rip), %xmm5
+	movdqa	.LC2(%rip), %xmm4
+	addq	%rdi, %rsi
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	movdqu	(%rax), %xmm2
+	addq	$16, %rax
+	movdqa	%xmm2, %xmm0
+	movdqa	%xmm2, %xmm1
+	paddb	%xmm6, %xmm0
+	paddb	%xmm4, %xmm1
+	psubusb	%xmm5, %xmm0
+	pcmpeqb	%xmm3, %xmm0
+	pand	%xmm0, %xmm1
+	pandn	%xmm2, %xmm0
+	por	%xmm1, %xmm0
+	movups	%xmm0, -16(%rax)
+	cmpq	%rsi, %rax
+	jne	.L41
+	movl	%edx, %eax
+	andl	$-16, %eax
+	movl	%eax, %esi
+	cmpl	%eax, %edx
+	je	.L60
+.L40:
+	movl	%edx, %edi
+	subl	%esi, %edi
+	leal	-1(%rdi), %r8d
+	cmpl	$6, %r8d
+	jbe	.L45
+	movq	.LC4(%rip), %xmm0
+	addq	%rcx, %rsi
+	movq	.LC5(%rip), %xmm3
+	movq	.LC6(%rip), %xmm1
+	movq	(%rsi), %xmm2
+	paddb	%xmm2, %xmm0
+	paddb	%xmm2, %xmm1
+	psubusb	%xmm3, %xmm0
+	pxor	%xmm3, %xmm3
+	pcmpeqb	%xmm3, %xmm0
+	pand	%xmm0, %xmm1
+	pandn	%xmm2, %xmm0
+	por	%xmm1, %xmm0
+	movq	%xmm0, (%rsi)
+	movl	%edi, %esi
+	andl	$-8, %esi
+	addl	%esi, %eax
+	andl	$7, %edi
+	je	.L38
+.L45:
+	movslq	%eax, %rdi
+	addq	%rcx, %rdi
+	movzbl	(%rdi), %esi
+	leal	-65(%rsi), %r9d
+	leal	32(%rsi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %esi
+	movb	%sil, (%rdi)
+	leal	1(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L38
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	2(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L38
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	3(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L38
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	4(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L38
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	movb	%dil, (%rsi)
+	leal	5(%rax), %esi
+	cmpl	%esi, %edx
+	jle	.L38
+	movslq	%esi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	addl	$6, %eax
+	movb	%dil, (%rsi)
+	cmpl	%eax, %edx
+	jle	.L38
+	cltq
+	addq	%rax, %rcx
+	movzbl	(%rcx), %eax
+	leal	-65(%rax), %esi
+	leal	32(%rax), %edx
+	cmpb	$26, %sil
+	cmovb	%edx, %eax
+	movb	%al, (%rcx)
+.L38:
+	ret
+.L55:
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	jmp	.L40
+.L60:
+	ret
+	.cfi_endproc
+.LFE13338:
+	.size	_Z18shift_range_scalarILc65ELc90ELcn32EEvPci, .-_Z18shift_range_scalarILc65ELc90ELcn32EEvPci
+	.text
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E9_M_invokeERKSt9_Any_data, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E9_M_invokeERKSt9_Any_data:
+.LFB13937:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rax
+	movq	(%rax), %rbx
+	movq	8(%rax), %r12
+	cmpq	%r12, %rbx
+	je	.L61
+	movq	%rdi, %rbp
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	movq	(%rbx), %rdi
+	movl	8(%rbx), %esi
+	addq	$24, %rbx
+	subl	%edi, %esi
+	call	*0(%rbp)
+	cmpq	%rbx, %r12
+	jne	.L63
+.L61:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13937:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E9_M_invokeERKSt9_Any_data, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E9_M_invokeERKSt9_Any_data
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E9_M_invokeERKSt9_Any_data, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E9_M_invokeERKSt9_Any_data:
+.LFB13947:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	8(%rdi), %r13
+	movq	24(%r13), %rax
+	movq	32(%r13), %rbp
+	subq	%rax, %rbp
+	sarq	$3, %rbp
+	subq	$1, %rbp
+	je	.L66
+	movq	%rdi, %r12
+	xorl	%ebx, %ebx
+	jmp	.L68
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	movq	24(%r13), %rax
+.L68:
+	leaq	0(,%rbx,8), %rcx
+	movq	(%rax,%rbx,8), %rdx
+	movq	0(%r13), %rdi
+	addq	$1, %rbx
+	movq	8(%rax,%rcx), %rsi
+	addq	%rdx, %rdi
+	subl	%edx, %esi
+	call	*(%r12)
+	cmpq	%rbx, %rbp
+	jne	.L73
+.L66:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13947:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E9_M_invokeERKSt9_Any_data, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E9_M_invokeERKSt9_Any_data
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E9_M_invokeERKSt9_Any_data, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E9_M_invokeERKSt9_Any_data:
+.LFB13954:
+	.cfi_startproc
+	movq	8(%rdi), %rdx
+	movq	(%rdx), %rax
+	movq	8(%rdx), %rsi
+	movq	(%rdi), %rdx
+	subl	%eax, %esi
+	movq	%rax, %rdi
+	jmp	*%rdx
+	.cfi_endproc
+.LFE13954:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E9_M_invokeERKSt9_Any_data, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E9_M_invokeERKSt9_Any_data
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E9_M_invokeERKSt9_Any_data, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E9_M_invokeERKSt9_Any_data:
+.LFB13961:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	8(%rdi), %r13
+	movq	24(%r13), %rax
+	movq	32(%r13), %rbp
+	subq	%rax, %rbp
+	sarq	$3, %rbp
+	subq	$1, %rbp
+	je	.L75
+	movq	%rdi, %r12
+	xorl	%ebx, %ebx
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movq	24(%r13), %rax
+.L77:
+	leaq	0(,%rbx,8), %rcx
+	movq	(%rax,%rbx,8), %rdx
+	movq	0(%r13), %rdi
+	addq	$1, %rbx
+	movq	8(%rax,%rcx), %rsi
+	addq	%rdx, %rdi
+	subl	%edx, %esi
+	call	*(%r12)
+	cmpq	%rbx, %rbp
+	jne	.L82
+.L75:
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13961:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E9_M_invokeERKSt9_Any_data, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E9_M_invokeERKSt9_Any_data
+	.p2align 4
+	.globl	_Z14all_alnum_sse2PKci
+	.type	_Z14all_alnum_sse2PKci, @function
+_Z14all_alnum_sse2PKci:
+.LFB12536:
+	.cfi_startproc
+	movl	%esi, %edx
+	cmpl	$15, %esi
+	jg	.L88
+	testl	%esi, %esi
+	jle	.L110
+	movzbl	(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$1, %esi
+	je	.L110
+	movzbl	1(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$2, %edx
+	je	.L110
+	movzbl	2(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$3, %edx
+	je	.L110
+	movzbl	3(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$4, %edx
+	je	.L110
+	movzbl	4(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$5, %edx
+	je	.L110
+	movzbl	5(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$6, %edx
+	je	.L110
+	movzbl	6(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$7, %edx
+	je	.L110
+	movzbl	7(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$8, %edx
+	je	.L110
+	movzbl	8(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$9, %edx
+	je	.L110
+	movzbl	9(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$10, %edx
+	je	.L110
+	movzbl	10(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$11, %edx
+	je	.L110
+	movzbl	11(%rdi), %ecx
+	movl	%ecx, %esi
+	orl	$32, %esi
+	subl	$97, %esi
+	cmpb	$25, %sil
+	seta	%sil
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	testb	%cl, %sil
+	jne	.L83
+	cmpl	$12, %edx
+	je	.L110
+	movzbl	12(%rdi), %ecx
+	movl	%ecx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	seta	%cl
+	andb	%cl, %al
+	jne	.L111
+	cmpl	$13, %edx
+	je	.L110
+	movzbl	13(%rdi), %esi
+	movl	%esi, %ecx
+	orl	$32, %ecx
+	subl	$97, %ecx
+	cmpb	$25, %cl
+	jbe	.L112
+	subl	$48, %esi
+	cmpb	$9, %sil
+	ja	.L83
+.L112:
+	cmpl	$15, %edx
+	jne	.L110
+	movzbl	14(%rdi), %edx
+	movl	%edx, %eax
+	orl	$32, %eax
+	subl	$97, %eax
+	cmpb	$25, %al
+	seta	%al
+	subl	$48, %edx
+	cmpb	$9, %dl
+	seta	%dl
+	andl	%edx, %eax
+	xorl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	movdqa	.LC7(%rip), %xmm7
+	movdqa	.LC8(%rip), %xmm6
+	xorl	%eax, %eax
+	leal	-16(%rsi), %esi
+	movdqa	.LC9(%rip), %xmm5
+	movdqa	.LC10(%rip), %xmm4
+	movdqa	.LC11(%rip), %xmm3
+	jmp	.L84
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	addl	$16, %eax
+	cmpl	%edx, %eax
+	je	.L110
+.L84:
+	leal	15(%rax), %ecx
+	movdqa	%xmm5, %xmm1
+	cmpl	%edx, %ecx
+	cmovge	%esi, %eax
+	movslq	%eax, %rcx
+	movdqu	(%rdi,%rcx), %xmm0
+	movdqa	%xmm0, %xmm2
+	paddb	%xmm4, %xmm0
+	por	%xmm7, %xmm2
+	paddb	%xmm6, %xmm2
+	pcmpgtb	%xmm2, %xmm1
+	movdqa	%xmm3, %xmm2
+	pcmpgtb	%xmm0, %xmm2
+	movdqa	%xmm1, %xmm0
+	por	%xmm2, %xmm0
+	pmovmskb	%xmm0, %ecx
+	cmpl	$65535, %ecx
+	je	.L117
+.L111:
+	xorl	%eax, %eax
+.L83:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE12536:
+	.size	_Z14all_alnum_sse2PKci, .-_Z14all_alnum_sse2PKci
+	.p2align 4
+	.globl	_Z16all_alnum_avx512PKci
+	.type	_Z16all_alnum_avx512PKci, @function
+_Z16all_alnum_avx512PKci:
+.LFB12538:
+	.cfi_startproc
+	movl	%esi, %ecx
+	testl	%esi, %esi
+	jle	.L119
+	leal	-1(%rcx), %eax
+	leal	-64(%rsi), %esi
+	movl	$1, %r8d
+	andl	$-64, %eax
+	subl	%eax, %esi
+	movl	$-48, %eax
+	vpbroadcastb	%eax, %zmm6
+	movl	$9, %eax
+	vpbroadcastb	%eax, %zmm5
+	movl	$538976288, %eax
+	vpbroadcastd	%eax, %zmm4
+	movl	$-97, %eax
+	vpbroadcastb	%eax, %zmm3
+	movl	$25, %eax
+	vpbroadcastb	%eax, %zmm2
+	jmp	.L122
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	subl	$64, %ecx
+	addq	$64, %rdi
+	cmpl	%esi, %ecx
+	je	.L127
+.L122:
+	movq	%r8, %rax
+	movq	$-1, %rdx
+	salq	%cl, %rax
+	subq	$1, %rax
+	cmpl	$64, %ecx
+	cmovge	%rdx, %rax
+	kmovq	%rax, %k2
+	vmovdqu8	(%rdi), %zmm0{%k2}{z}
+	vpaddb	%zmm6, %zmm0, %zmm1
+	vpord	%zmm4, %zmm0, %zmm0
+	vpaddb	%zmm3, %zmm0, %zmm0
+	vpcmpub	$2, %zmm5, %zmm1, %k0
+	vpcmpub	$2, %zmm2, %zmm0, %k1
+	kmovq	%k0, %r9
+	kmovq	%k1, %rdx
+	orq	%r9, %rdx
+	andq	%rax, %rdx
+	cmpq	%rax, %rdx
+	je	.L128
+	xorl	%eax, %eax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	vzeroupper
+.L119:
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE12538:
+	.size	_Z16all_alnum_avx512PKci, .-_Z16all_alnum_avx512PKci
+	.section	.text._Z18shift_range_avx512ILc97ELc122ELc32EEvPci,"axG",@progbits,_Z18shift_range_avx512ILc97ELc122ELc32EEvPci,comdat
+	.p2align 4
+	.weak	_Z18shift_range_avx512ILc97ELc122ELc32EEvPci
+	.type	_Z18shift_range_avx512ILc97ELc122ELc32EEvPci, @function
+_Z18shift_range_avx512ILc97ELc122ELc32EEvPci:
+.LFB13347:
+	.cfi_startproc
+	movl	%esi, %ecx
+	testl	%esi, %esi
+	jle	.L134
+	leal	-1(%rsi), %eax
+	leal	-64(%rsi), %edx
+	movl	$1, %esi
+	andl	$-64, %eax
+	subl	%eax, %edx
+	movl	$-97, %eax
+	vpbroadcastb	%eax, %zmm3
+	movl	$25, %eax
+	vpbroadcastb	%eax, %zmm2
+	movl	$-32, %eax
+	vpbroadcastb	%eax, %zmm1
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	cmpl	$63, %ecx
+	jg	.L131
+	movq	%rsi, %rax
+	salq	%cl, %rax
+	subl	$64, %ecx
+	subq	$1, %rax
+	kmovq	%rax, %k1
+	vmovdqu8	(%rdi), %zmm0{%k1}{z}
+	vpaddb	%zmm3, %zmm0, %zmm4
+	vpaddb	%zmm1, %zmm0, %zmm0
+	vpcmpub	$2, %zmm2, %zmm4, %k1{%k1}
+	vmovdqu8	%zmm0, (%rdi){%k1}
+	addq	$64, %rdi
+	cmpl	%ecx, %edx
+	jne	.L133
+	vzeroupper
+.L134:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	vpaddb	(%rdi), %zmm3, %zmm0
+	subl	$64, %ecx
+	vpcmpub	$2, %zmm2, %zmm0, %k1
+	vpaddb	(%rdi), %zmm1, %zmm0
+	vmovdqu8	%zmm0, (%rdi){%k1}
+	addq	$64, %rdi
+	cmpl	%edx, %ecx
+	jne	.L133
+	vzeroupper
+	jmp	.L134
+	.cfi_endproc
+.LFE13347:
+	.size	_Z18shift_range_avx512ILc97ELc122ELc32EEvPci, .-_Z18shift_range_avx512ILc97ELc122ELc32EEvPci
+	.section	.text._Z18shift_range_avx512ILc65ELc90ELcn32EEvPci,"axG",@progbits,_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci,comdat
+	.p2align 4
+	.weak	_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci
+	.type	_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci, @function
+_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci:
+.LFB13348:
+	.cfi_startproc
+	movl	%esi, %ecx
+	testl	%esi, %esi
+	jle	.L141
+	leal	-1(%rsi), %eax
+	leal	-64(%rsi), %edx
+	movl	$1, %esi
+	andl	$-64, %eax
+	subl	%eax, %edx
+	movl	$-65, %eax
+	vpbroadcastb	%eax, %zmm3
+	movl	$25, %eax
+	vpbroadcastb	%eax, %zmm2
+	movl	$32, %eax
+	vpbroadcastb	%eax, %zmm1
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	cmpl	$63, %ecx
+	jg	.L138
+	movq	%rsi, %rax
+	salq	%cl, %rax
+	subl	$64, %ecx
+	subq	$1, %rax
+	kmovq	%rax, %k1
+	vmovdqu8	(%rdi), %zmm0{%k1}{z}
+	vpaddb	%zmm3, %zmm0, %zmm4
+	vpaddb	%zmm1, %zmm0, %zmm0
+	vpcmpub	$2, %zmm2, %zmm4, %k1{%k1}
+	vmovdqu8	%zmm0, (%rdi){%k1}
+	addq	$64, %rdi
+	cmpl	%ecx, %edx
+	jne	.L140
+	vzeroupper
+.L141:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	vpaddb	(%rdi), %zmm3, %zmm0
+	subl	$64, %ecx
+	vpcmpub	$2, %zmm2, %zmm0, %k1
+	vpaddb	(%rdi), %zmm1, %zmm0
+	vmovdqu8	%zmm0, (%rdi){%k1}
+	addq	$64, %rdi
+	cmpl	%edx, %ecx
+	jne	.L140
+	vzeroupper
+	jmp	.L141
+	.cfi_endproc
+.LFE13348:
+	.size	_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci, .-_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci
+	.text
+	.p2align 4
+	.globl	_Z14all_alnum_avx2PKci
+	.type	_Z14all_alnum_avx2PKci, @function
+_Z14all_alnum_avx2PKci:
+.LFB12537:
+	.cfi_startproc
+	cmpl	$31, %esi
+	jg	.L147
+	jmp	_Z14all_alnum_sse2PKci
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	movabsq	$2314885530818453536, %rdx
+	xorl	%eax, %eax
+	leal	-32(%rsi), %ecx
+	vmovq	%rdx, %xmm6
+	movl	$31, %edx
+	vmovd	%edx, %xmm5
+	movl	$-102, %edx
+	vpbroadcastq	%xmm6, %ymm6
+	vmovd	%edx, %xmm4
+	movl	$80, %edx
+	vpbroadcastb	%xmm5, %ymm5
+	vmovd	%edx, %xmm3
+	movl	$-118, %edx
+	vpbroadcastb	%xmm4, %ymm4
+	vmovd	%edx, %xmm2
+	vpbroadcastb	%xmm3, %ymm3
+	vpbroadcastb	%xmm2, %ymm2
+	jmp	.L144
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	addl	$32, %eax
+	cmpl	%eax, %esi
+	je	.L151
+.L144:
+	leal	31(%rax), %edx
+	cmpl	%edx, %esi
+	cmovle	%ecx, %eax
+	movslq	%eax, %rdx
+	vmovdqu	(%rdi,%rdx), %ymm1
+	vpor	%ymm6, %ymm1, %ymm0
+	vpaddb	%ymm3, %ymm1, %ymm1
+	vpaddb	%ymm5, %ymm0, %ymm0
+	vpcmpgtb	%ymm1, %ymm2, %ymm1
+	vpcmpgtb	%ymm0, %ymm4, %ymm0
+	vpor	%ymm1, %ymm0, %ymm0
+	vpmovmskb	%ymm0, %edx
+	cmpl	$-1, %edx
+	je	.L152
+	xorl	%eax, %eax
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	movl	$1, %eax
+	vzeroupper
+	ret
+	.cfi_endproc
+.LFE12537:
+	.size	_Z14all_alnum_avx2PKci, .-_Z14all_alnum_avx2PKci
+	.section	.text._Z16shift_range_sse2ILc97ELc122ELc32EEvPci,"axG",@progbits,_Z16shift_range_sse2ILc97ELc122ELc32EEvPci,comdat
+	.p2align 4
+	.weak	_Z16shift_range_sse2ILc97ELc122ELc32EEvPci
+	.type	_Z16shift_range_sse2ILc97ELc122ELc32EEvPci, @function
+_Z16shift_range_sse2ILc97ELc122ELc32EEvPci:
+.LFB13343:
+	.cfi_startproc
+	movl	%esi, %edx
+	cmpl	$15, %esi
+	jle	.L198
+	movdqa	.LC8(%rip), %xmm4
+	movdqa	.LC9(%rip), %xmm3
+	xorl	%eax, %eax
+	movdqa	.LC7(%rip), %xmm2
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	leal	15(%rax), %ecx
+	cmpl	%ecx, %edx
+	jg	.L199
+	subl	$16, %edx
+	movslq	%edx, %rdx
+	leaq	(%rdi,%rdx), %rax
+	movdqu	(%rax), %xmm5
+	paddb	%xmm5, %xmm4
+	movdqa	%xmm5, %xmm0
+	pcmpgtb	%xmm4, %xmm3
+	pand	%xmm3, %xmm2
+	psubb	%xmm2, %xmm0
+	movups	%xmm0, (%rax)
+.L153:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	leal	16(%rax), %ecx
+	addq	%rdi, %rax
+	movdqa	%xmm3, %xmm1
+	movdqu	(%rax), %xmm0
+	paddb	%xmm4, %xmm0
+	pcmpgtb	%xmm0, %xmm1
+	movdqu	(%rax), %xmm0
+	pand	%xmm2, %xmm1
+	psubb	%xmm1, %xmm0
+	movups	%xmm0, (%rax)
+	cmpl	%ecx, %edx
+	je	.L153
+	movslq	%ecx, %rax
+	jmp	.L154
+	.p2align 4,,10
+	.p2align 3
+.L198:
+	testl	%esi, %esi
+	jle	.L153
+	movzbl	(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, (%rdi)
+	cmpl	$1, %esi
+	je	.L153
+	movzbl	1(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 1(%rdi)
+	cmpl	$2, %esi
+	je	.L153
+	movzbl	2(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 2(%rdi)
+	cmpl	$3, %esi
+	je	.L153
+	movzbl	3(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 3(%rdi)
+	cmpl	$4, %esi
+	je	.L153
+	movzbl	4(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 4(%rdi)
+	cmpl	$5, %esi
+	je	.L153
+	movzbl	5(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 5(%rdi)
+	cmpl	$6, %esi
+	je	.L153
+	movzbl	6(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 6(%rdi)
+	cmpl	$7, %esi
+	je	.L153
+	movzbl	7(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 7(%rdi)
+	cmpl	$8, %esi
+	je	.L153
+	movzbl	8(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 8(%rdi)
+	cmpl	$9, %esi
+	je	.L153
+	movzbl	9(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 9(%rdi)
+	cmpl	$10, %esi
+	je	.L153
+	movzbl	10(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 10(%rdi)
+	cmpl	$11, %esi
+	je	.L153
+	movzbl	11(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 11(%rdi)
+	cmpl	$12, %esi
+	je	.L153
+	movzbl	12(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 12(%rdi)
+	cmpl	$13, %esi
+	je	.L153
+	movzbl	13(%rdi), %eax
+	leal	-97(%rax), %ecx
+	cmpb	$25, %cl
+	setbe	%cl
+	sall	$5, %ecx
+	subl	%ecx, %eax
+	movb	%al, 13(%rdi)
+	cmpl	$15, %esi
+	jne	.L153
+	movzbl	14(%rdi), %eax
+	leal	-97(%rax), %edx
+	cmpb	$25, %dl
+	setbe	%dl
+	sall	$5, %edx
+	subl	%edx, %eax
+	movb	%al, 14(%rdi)
+	ret
+	.cfi_endproc
+.LFE13343:
+	.size	_Z16shift_range_sse2ILc97ELc122ELc32EEvPci, .-_Z16shift_range_sse2ILc97ELc122ELc32EEvPci
+	.section	.text._Z16shift_range_sse2ILc65ELc90ELcn32EEvPci,"axG",@progbits,_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci,comdat
+	.p2align 4
+	.weak	_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci
+	.type	_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci, @function
+_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci:
+.LFB13344:
+	.cfi_startproc
+	movq	%rdi, %rcx
+	movl	%esi, %edx
+	cmpl	$15, %esi
+	jle	.L221
+	movdqa	.LC28(%rip), %xmm4
+	movdqa	.LC9(%rip), %xmm3
+	xorl	%eax, %eax
+	movdqa	.LC29(%rip), %xmm2
+	.p2align 4,,10
+	.p2align 3
+.L201:
+	leal	15(%rax), %esi
+	cmpl	%esi, %edx
+	jg	.L222
+	subl	$16, %edx
+	movslq	%edx, %rdx
+	addq	%rdx, %rcx
+	movdqu	(%rcx), %xmm5
+	paddb	%xmm5, %xmm4
+	movdqa	%xmm5, %xmm0
+	pcmpgtb	%xmm4, %xmm3
+	pand	%xmm3, %xmm2
+	psubb	%xmm2, %xmm0
+	movups	%xmm0, (%rcx)
+.L200:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	leal	16(%rax), %esi
+	addq	%rcx, %rax
+	movdqa	%xmm3, %xmm1
+	movdqu	(%rax), %xmm0
+	paddb	%xmm4, %xmm0
+	pcmpgtb	%xmm0, %xmm1
+	movdqu	(%rax), %xmm0
+	pand	%xmm2, %xmm1
+	psubb	%xmm1, %xmm0
+	movups	%xmm0, (%rax)
+	cmpl	%esi, %edx
+	je	.L200
+	movslq	%esi, %rax
+	jmp	.L201
+	.p2align 4,,10
+	.p2align 3
+.L221:
+	testl	%esi, %esi
+	jle	.L200
+	leal	-1(%rsi), %eax
+	cmpl	$6, %eax
+	jbe	.L214
+	movq	.LC4(%rip), %xmm0
+	movq	(%rdi), %xmm2
+	movq	.LC5(%rip), %xmm3
+	movq	.LC6(%rip), %xmm1
+	paddb	%xmm2, %xmm0
+	paddb	%xmm2, %xmm1
+	psubusb	%xmm3, %xmm0
+	pxor	%xmm3, %xmm3
+	pcmpeqb	%xmm3, %xmm0
+	pand	%xmm0, %xmm1
+	pandn	%xmm2, %xmm0
+	por	%xmm1, %xmm0
+	movq	%xmm0, (%rdi)
+	cmpl	$8, %esi
+	je	.L200
+	movl	$8, %esi
+	movl	$8, %edi
+.L203:
+	movl	%edx, %r8d
+	subl	%esi, %r8d
+	leal	-1(%r8), %eax
+	cmpl	$2, %eax
+	jbe	.L206
+	movl	%esi, %eax
+	movd	.LC25(%rip), %xmm0
+	movd	.LC26(%rip), %xmm3
+	addq	%rcx, %rax
+	movd	.LC27(%rip), %xmm1
+	movd	(%rax), %xmm2
+	paddb	%xmm2, %xmm0
+	paddb	%xmm2, %xmm1
+	psubusb	%xmm3, %xmm0
+	pxor	%xmm3, %xmm3
+	pcmpeqb	%xmm3, %xmm0
+	pand	%xmm0, %xmm1
+	pandn	%xmm2, %xmm0
+	por	%xmm1, %xmm0
+	movd	%xmm0, (%rax)
+	testb	$3, %r8b
+	je	.L200
+	andl	$-4, %r8d
+	addl	%r8d, %edi
+.L206:
+	movslq	%edi, %rsi
+	addq	%rcx, %rsi
+	movzbl	(%rsi), %eax
+	leal	-65(%rax), %r9d
+	leal	32(%rax), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %eax
+	movb	%al, (%rsi)
+	leal	1(%rdi), %eax
+	cmpl	%eax, %edx
+	jle	.L200
+	cltq
+	addq	%rcx, %rax
+	movzbl	(%rax), %esi
+	leal	-65(%rsi), %r9d
+	leal	32(%rsi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %esi
+	movb	%sil, (%rax)
+	leal	2(%rdi), %eax
+	cmpl	%eax, %edx
+	jle	.L200
+	cltq
+	addq	%rcx, %rax
+	movzbl	(%rax), %edx
+	leal	-65(%rdx), %esi
+	leal	32(%rdx), %ecx
+	cmpb	$26, %sil
+	cmovb	%ecx, %edx
+	movb	%dl, (%rax)
+	ret
+.L214:
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+	jmp	.L203
+	.cfi_endproc
+.LFE13344:
+	.size	_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci, .-_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci
+	.text
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation:
+.LFB13933:
+	.cfi_startproc
+	testl	%edx, %edx
+	je	.L224
+	cmpl	$1, %edx
+	je	.L225
+	cmpl	$2, %edx
+	je	.L229
+.L227:
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	leaq	_ZTIZ4mainEUlvE0_(%rip), %rax
+	movq	%rax, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	movq	%rsi, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	movdqu	(%rsi), %xmm0
+	movups	%xmm0, (%rdi)
+	jmp	.L227
+	.cfi_endproc
+.LFE13933:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation:
+.LFB13940:
+	.cfi_startproc
+	testl	%edx, %edx
+	je	.L231
+	cmpl	$1, %edx
+	je	.L232
+	cmpl	$2, %edx
+	je	.L236
+.L234:
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	leaq	_ZTIZ4mainEUlvE1_(%rip), %rax
+	movq	%rax, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L232:
+	movq	%rsi, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	movdqu	(%rsi), %xmm0
+	movups	%xmm0, (%rdi)
+	jmp	.L234
+	.cfi_endproc
+.LFE13940:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation:
+.LFB13950:
+	.cfi_startproc
+	testl	%edx, %edx
+	je	.L238
+	cmpl	$1, %edx
+	je	.L239
+	cmpl	$2, %edx
+	je	.L243
+.L241:
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	leaq	_ZTIZ4mainEUlvE2_(%rip), %rax
+	movq	%rax, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	movq	%rsi, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	movdqu	(%rsi), %xmm0
+	movups	%xmm0, (%rdi)
+	jmp	.L241
+	.cfi_endproc
+.LFE13950:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation:
+.LFB13957:
+	.cfi_startproc
+	testl	%edx, %edx
+	je	.L245
+	cmpl	$1, %edx
+	je	.L246
+	cmpl	$2, %edx
+	je	.L250
+.L248:
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	leaq	_ZTIZ4mainEUlvE3_(%rip), %rax
+	movq	%rax, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	movq	%rsi, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	movdqu	(%rsi), %xmm0
+	movups	%xmm0, (%rdi)
+	jmp	.L248
+	.cfi_endproc
+.LFE13957:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation:
+.LFB13964:
+	.cfi_startproc
+	testl	%edx, %edx
+	je	.L252
+	cmpl	$1, %edx
+	je	.L253
+	cmpl	$2, %edx
+	je	.L257
+.L255:
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	leaq	_ZTIZ4mainEUlvE4_(%rip), %rax
+	movq	%rax, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	movq	%rsi, (%rdi)
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	movdqu	(%rsi), %xmm0
+	movups	%xmm0, (%rdi)
+	jmp	.L255
+	.cfi_endproc
+.LFE13964:
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation
+	.section	.text._ZN4perf8CountersD2Ev,"axG",@progbits,_ZN4perf8CountersD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4perf8CountersD2Ev
+	.type	_ZN4perf8CountersD2Ev, @function
+_ZN4perf8CountersD2Ev:
+.LFB12499:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12499
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbx
+	movq	16(%rdi), %r12
+	movl	(%rdi), %eax
+	cmpq	%rbx, %r12
+	je	.L259
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	movl	(%rbx), %edi
+	cmpl	%eax, %edi
+	je	.L260
+	call	close@PLT
+	addq	$4, %rbx
+	movl	0(%rbp), %eax
+	cmpq	%rbx, %r12
+	jne	.L262
+.L259:
+	testl	%eax, %eax
+	js	.L263
+	movl	%eax, %edi
+	call	close@PLT
+.L263:
+	movq	32(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L264
+	movq	48(%rbp), %rsi
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+.L264:
+	movq	8(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L258
+	movq	24(%rbp), %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	subq	%rdi, %rsi
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	.cfi_restore_state
+	addq	$4, %rbx
+	cmpq	%rbx, %r12
+	jne	.L262
+	jmp	.L259
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12499:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN4perf8CountersD2Ev,"aG",@progbits,_ZN4perf8CountersD5Ev,comdat
+.LLSDA12499:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE12499-.LLSDACSB12499
+.LLSDACSB12499:
+.LLSDACSE12499:
+	.section	.text._ZN4perf8CountersD2Ev,"axG",@progbits,_ZN4perf8CountersD5Ev,comdat
+	.size	_ZN4perf8CountersD2Ev, .-_ZN4perf8CountersD2Ev
+	.weak	_ZN4perf8CountersD1Ev
+	.set	_ZN4perf8CountersD1Ev,_ZN4perf8CountersD2Ev
+	.text
+	.p2align 4
+	.type	_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0, @function
+_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0:
+.LFB14806:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movq	(%rdi), %rax
+	movq	-24(%rax), %rax
+	movq	240(%rdi,%rax), %rbp
+	testq	%rbp, %rbp
+	je	.L276
+	cmpb	$0, 56(%rbp)
+	movq	%rdi, %rbx
+	je	.L272
+	movsbl	67(%rbp), %esi
+.L273:
+	movq	%rbx, %rdi
+	call	_ZNSo3putEc@PLT
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	movq	%rax, %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	jmp	_ZNSo5flushEv@PLT
+	.p2align 4,,10
+	.p2align 3
+.L272:
+	.cfi_restore_state
+	movq	%rbp, %rdi
+	call	_ZNKSt5ctypeIcE13_M_widen_initEv@PLT
+	movq	0(%rbp), %rax
+	movl	$10, %esi
+	leaq	_ZNKSt5ctypeIcE8do_widenEc(%rip), %rdx
+	movq	48(%rax), %rax
+	cmpq	%rdx, %rax
+	je	.L273
+	movq	%rbp, %rdi
+	call	*%rax
+	movsbl	%al, %esi
+	jmp	.L273
+.L276:
+	call	_ZSt16__throw_bad_castv@PLT
+	.cfi_endproc
+.LFE14806:
+	.size	_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0, .-_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0
+	.section	.text._ZN12AsciiKernelsD2Ev,"axG",@progbits,_ZN12AsciiKernelsD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN12AsciiKernelsD2Ev
+	.type	_ZN12AsciiKernelsD2Ev, @function
+_ZN12AsciiKernelsD2Ev:
+.LFB12622:
+	.cfi_startproc
+	movq	(%rdi), %rax
+	leaq	16(%rdi), %rdx
+	cmpq	%rdx, %rax
+	je	.L277
+	movq	16(%rdi), %rsi
+	movq	%rax, %rdi
+	addq	$1, %rsi
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	ret
+	.cfi_endproc
+.LFE12622:
+	.size	_ZN12AsciiKernelsD2Ev, .-_ZN12AsciiKernelsD2Ev
+	.weak	_ZN12AsciiKernelsD1Ev
+	.set	_ZN12AsciiKernelsD1Ev,_ZN12AsciiKernelsD2Ev
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC30:
+	.string	"basic_string: construction from null is not valid"
+	.text
+	.align 2
+	.p2align 4
+	.type	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0, @function
+_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0:
+.LFB14810:
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	16(%rdi), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	movq	%r13, (%rdi)
+	testq	%rsi, %rsi
+	je	.L290
+	movq	%rdi, %rbp
+	movq	%rsi, %rdi
+	movq	%rsi, %r12
+	call	strlen@PLT
+	movq	%rax, %rbx
+	cmpq	$15, %rax
+	ja	.L291
+	cmpq	$1, %rax
+	je	.L292
+	testq	%rax, %rax
+	jne	.L282
+.L284:
+	movq	%rbx, 8(%rbp)
+	movb	$0, 0(%r13,%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L292:
+	.cfi_restore_state
+	movzbl	(%r12), %eax
+	movb	%al, 16(%rbp)
+	jmp	.L284
+	.p2align 4,,10
+	.p2align 3
+.L291:
+	leaq	1(%rax), %rdi
+	call	_Znwm@PLT
+	movq	%rbx, 16(%rbp)
+	movq	%rax, 0(%rbp)
+	movq	%rax, %r13
+.L282:
+	movq	%r13, %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	memcpy@PLT
+	movq	0(%rbp), %r13
+	jmp	.L284
+.L290:
+	leaq	.LC30(%rip), %rdi
+	call	_ZSt19__throw_logic_errorPKc@PLT
+	.cfi_endproc
+.LFE14810:
+	.size	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0, .-_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0
+	.section	.text.unlikely,"ax",@progbits
+.LCOLDB31:
+	.text
+.LHOTB31:
+	.p2align 4
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data:
+.LFB13929:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA13929
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	8(%rdi), %rax
+	movq	8(%rax), %r15
+	movq	(%rax), %rbx
+	cmpq	%r15, %rbx
+	je	.L293
+	movq	%rdi, %r14
+	jmp	.L304
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	js	.L315
+	movq	%rbp, %rdi
+.LEHB0:
+	call	_Znwm@PLT
+.LEHE0:
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %r12
+	movq	%rax, %r13
+	subq	%rsi, %r12
+	je	.L298
+	movq	%rax, %rdi
+	movq	%r12, %rdx
+	call	memmove@PLT
+	movl	%r12d, %esi
+	movq	%r13, %rdi
+.LEHB1:
+	call	*(%r14)
+.LEHE1:
+.L299:
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	addq	$24, %rbx
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %r15
+	je	.L293
+.L304:
+	movq	8(%rbx), %rbp
+	subq	(%rbx), %rbp
+	jne	.L295
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+.LEHB2:
+	call	*(%r14)
+.LEHE2:
+	addq	$24, %rbx
+	cmpq	%rbx, %r15
+	jne	.L304
+.L293:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L298:
+	.cfi_restore_state
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+.LEHB3:
+	call	*(%r14)
+.LEHE3:
+	jmp	.L299
+	.p2align 4,,10
+	.p2align 3
+.L315:
+.LEHB4:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE4:
+.L306:
+	movq	%rax, %rbx
+	jmp	.L301
+.L308:
+	movq	%rax, %rbx
+	jmp	.L302
+.L307:
+	movq	%rax, %rbx
+	jmp	.L303
+	.section	.gcc_except_table,"a",@progbits
+.LLSDA13929:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE13929-.LLSDACSB13929
+.LLSDACSB13929:
+	.uleb128 .LEHB0-.LFB13929
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB13929
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 .L307-.LFB13929
+	.uleb128 0
+	.uleb128 .LEHB2-.LFB13929
+	.uleb128 .LEHE2-.LEHB2
+	.uleb128 .L308-.LFB13929
+	.uleb128 0
+	.uleb128 .LEHB3-.LFB13929
+	.uleb128 .LEHE3-.LEHB3
+	.uleb128 .L306-.LFB13929
+	.uleb128 0
+	.uleb128 .LEHB4-.LFB13929
+	.uleb128 .LEHE4-.LEHB4
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE13929:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC13929
+	.type	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data.cold, @function
+_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data.cold:
+.LFSB13929:
+.L301:
+	.cfi_def_cfa_offset 64
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	testq	%r13, %r13
+	je	.L302
+.L303:
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	_ZdlPvm@PLT
+.L302:
+	movq	%rbx, %rdi
+.LEHB5:
+	call	_Unwind_Resume@PLT
+.LEHE5:
+	.cfi_endproc
+.LFE13929:
+	.section	.gcc_except_table
+.LLSDAC13929:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC13929-.LLSDACSBC13929
+.LLSDACSBC13929:
+	.uleb128 .LEHB5-.LCOLDB31
+	.uleb128 .LEHE5-.LEHB5
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC13929:
+	.section	.text.unlikely
+	.text
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data
+	.section	.text.unlikely
+	.size	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data.cold, .-_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data.cold
+.LCOLDE31:
+	.text
+.LHOTE31:
+	.section	.text._Z16shift_range_avx2ILc97ELc122ELc32EEvPci,"axG",@progbits,_Z16shift_range_avx2ILc97ELc122ELc32EEvPci,comdat
+	.p2align 4
+	.weak	_Z16shift_range_avx2ILc97ELc122ELc32EEvPci
+	.type	_Z16shift_range_avx2ILc97ELc122ELc32EEvPci, @function
+_Z16shift_range_avx2ILc97ELc122ELc32EEvPci:
+.LFB13345:
+	.cfi_startproc
+	movq	%rdi, %rcx
+	movl	%esi, %edx
+	xorl	%eax, %eax
+	cmpl	$31, %esi
+	jle	.L369
+	movabsq	$2314885530818453536, %rdi
+	movl	$31, %esi
+	vmovd	%esi, %xmm3
+	movl	$-102, %esi
+	vmovq	%rdi, %xmm1
+	vmovd	%esi, %xmm2
+	vpbroadcastb	%xmm3, %ymm3
+	vpbroadcastq	%xmm1, %ymm1
+	vpbroadcastb	%xmm2, %ymm2
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	leal	31(%rax), %esi
+	cmpl	%esi, %edx
+	jg	.L373
+	subl	$32, %edx
+	movl	$31, %eax
+	movslq	%edx, %rdx
+	vmovd	%eax, %xmm1
+	movl	$-102, %eax
+	addq	%rdx, %rcx
+	vmovd	%eax, %xmm0
+	vpbroadcastb	%xmm1, %ymm1
+	movabsq	$2314885530818453536, %rax
+	vpaddb	(%rcx), %ymm1, %ymm1
+	vpbroadcastb	%xmm0, %ymm0
+	vmovdqu	(%rcx), %ymm5
+	vpcmpgtb	%ymm1, %ymm0, %ymm0
+	vmovq	%rax, %xmm1
+	vpbroadcastq	%xmm1, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpsubb	%ymm0, %ymm5, %ymm0
+	vmovdqu	%ymm0, (%rcx)
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	leal	32(%rax), %esi
+	addq	%rcx, %rax
+	vpaddb	(%rax), %ymm3, %ymm0
+	vmovdqu	(%rax), %ymm4
+	vpcmpgtb	%ymm0, %ymm2, %ymm0
+	vpand	%ymm1, %ymm0, %ymm0
+	vpsubb	%ymm0, %ymm4, %ymm0
+	vmovdqu	%ymm0, (%rax)
+	cmpl	%esi, %edx
+	je	.L371
+	movslq	%esi, %rax
+	jmp	.L317
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	xorl	%eax, %eax
+	cmpl	$15, %esi
+	jle	.L370
+	movabsq	$2314885530818453536, %rdi
+	movl	$31, %esi
+	vmovd	%esi, %xmm3
+	movl	$-102, %esi
+	vmovq	%rdi, %xmm1
+	vmovd	%esi, %xmm2
+	vpbroadcastb	%xmm3, %xmm3
+	vpunpcklqdq	%xmm1, %xmm1, %xmm1
+	vpbroadcastb	%xmm2, %xmm2
+	.p2align 4,,10
+	.p2align 3
+.L318:
+	addl	$15, %eax
+	cmpl	%eax, %edx
+	jg	.L374
+	subl	$16, %edx
+	movl	$31, %eax
+	movslq	%edx, %rdx
+	vmovd	%eax, %xmm1
+	movl	$-102, %eax
+	addq	%rcx, %rdx
+	vmovd	%eax, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	movabsq	$2314885530818453536, %rax
+	vpaddb	(%rdx), %xmm1, %xmm1
+	vpbroadcastb	%xmm0, %xmm0
+	vmovdqu	(%rdx), %xmm7
+	vpcmpgtb	%xmm1, %xmm0, %xmm0
+	vmovq	%rax, %xmm1
+	vpunpcklqdq	%xmm1, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpsubb	%xmm0, %xmm7, %xmm0
+	vmovdqu	%xmm0, (%rdx)
+	ret
+.L370:
+	testl	%esi, %esi
+	jle	.L372
+	movzbl	(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, (%rdi)
+	cmpl	$1, %edx
+	je	.L372
+	movzbl	1(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 1(%rdi)
+	cmpl	$2, %edx
+	je	.L372
+	movzbl	2(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 2(%rdi)
+	cmpl	$3, %edx
+	je	.L372
+	movzbl	3(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 3(%rdi)
+	cmpl	$4, %edx
+	je	.L372
+	movzbl	4(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 4(%rdi)
+	cmpl	$5, %edx
+	je	.L372
+	movzbl	5(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 5(%rdi)
+	cmpl	$6, %edx
+	je	.L372
+	movzbl	6(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 6(%rdi)
+	cmpl	$7, %edx
+	je	.L372
+	movzbl	7(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 7(%rdi)
+	cmpl	$8, %edx
+	je	.L372
+	movzbl	8(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 8(%rdi)
+	cmpl	$9, %edx
+	je	.L372
+	movzbl	9(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 9(%rdi)
+	cmpl	$10, %edx
+	je	.L372
+	movzbl	10(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 10(%rdi)
+	cmpl	$11, %edx
+	je	.L372
+	movzbl	11(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 11(%rdi)
+	cmpl	$12, %edx
+	je	.L372
+	movzbl	12(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 12(%rdi)
+	cmpl	$13, %edx
+	je	.L372
+	movzbl	13(%rdi), %eax
+	leal	-97(%rax), %esi
+	cmpb	$25, %sil
+	setbe	%sil
+	sall	$5, %esi
+	subl	%esi, %eax
+	movb	%al, 13(%rdi)
+	cmpl	$15, %edx
+	jne	.L372
+	movzbl	14(%rdi), %eax
+	leal	-97(%rax), %edx
+	cmpb	$25, %dl
+	setbe	%dl
+	sall	$5, %edx
+	subl	%edx, %eax
+	movb	%al, 14(%rdi)
+	ret
+.L371:
+	vzeroupper
+.L372:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	vpaddb	(%rcx), %xmm3, %xmm0
+	vmovdqu	(%rcx), %xmm6
+	movl	$16, %eax
+	vpcmpgtb	%xmm0, %xmm2, %xmm0
+	vpand	%xmm1, %xmm0, %xmm0
+	vpsubb	%xmm0, %xmm6, %xmm0
+	vmovdqu	%xmm0, (%rcx)
+	cmpl	$16, %edx
+	jne	.L318
+	ret
+	.cfi_endproc
+.LFE13345:
+	.size	_Z16shift_range_avx2ILc97ELc122ELc32EEvPci, .-_Z16shift_range_avx2ILc97ELc122ELc32EEvPci
+	.section	.text._Z16shift_range_avx2ILc65ELc90ELcn32EEvPci,"axG",@progbits,_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci,comdat
+	.p2align 4
+	.weak	_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci
+	.type	_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci, @function
+_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci:
+.LFB13346:
+	.cfi_startproc
+	movq	%rdi, %rcx
+	movl	%esi, %edx
+	xorl	%eax, %eax
+	cmpl	$31, %esi
+	jle	.L404
+	movabsq	$-2242545357980376864, %rdi
+	movl	$63, %esi
+	vmovd	%esi, %xmm3
+	movl	$-102, %esi
+	vmovq	%rdi, %xmm1
+	vmovd	%esi, %xmm2
+	vpbroadcastb	%xmm3, %ymm3
+	vpbroadcastq	%xmm1, %ymm1
+	vpbroadcastb	%xmm2, %ymm2
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	leal	31(%rax), %esi
+	cmpl	%esi, %edx
+	jg	.L408
+	subl	$32, %edx
+	movl	$63, %eax
+	movslq	%edx, %rdx
+	vmovd	%eax, %xmm1
+	movl	$-102, %eax
+	addq	%rdx, %rcx
+	vmovd	%eax, %xmm0
+	vpbroadcastb	%xmm1, %ymm1
+	movabsq	$-2242545357980376864, %rax
+	vpaddb	(%rcx), %ymm1, %ymm1
+	vpbroadcastb	%xmm0, %ymm0
+	vmovdqu	(%rcx), %ymm5
+	vpcmpgtb	%ymm1, %ymm0, %ymm0
+	vmovq	%rax, %xmm1
+	vpbroadcastq	%xmm1, %ymm1
+	vpand	%ymm1, %ymm0, %ymm0
+	vpsubb	%ymm0, %ymm5, %ymm0
+	vmovdqu	%ymm0, (%rcx)
+	vzeroupper
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L408:
+	leal	32(%rax), %esi
+	addq	%rcx, %rax
+	vpaddb	(%rax), %ymm3, %ymm0
+	vmovdqu	(%rax), %ymm4
+	vpcmpgtb	%ymm0, %ymm2, %ymm0
+	vpand	%ymm1, %ymm0, %ymm0
+	vpsubb	%ymm0, %ymm4, %ymm0
+	vmovdqu	%ymm0, (%rax)
+	cmpl	%esi, %edx
+	je	.L406
+	movslq	%esi, %rax
+	jmp	.L376
+	.p2align 4,,10
+	.p2align 3
+.L404:
+	xorl	%eax, %eax
+	cmpl	$15, %esi
+	jle	.L405
+	movabsq	$-2242545357980376864, %rdi
+	movl	$63, %esi
+	vmovd	%esi, %xmm3
+	movl	$-102, %esi
+	vmovq	%rdi, %xmm1
+	vmovd	%esi, %xmm2
+	vpbroadcastb	%xmm3, %xmm3
+	vpunpcklqdq	%xmm1, %xmm1, %xmm1
+	vpbroadcastb	%xmm2, %xmm2
+	.p2align 4,,10
+	.p2align 3
+.L377:
+	addl	$15, %eax
+	cmpl	%eax, %edx
+	jg	.L409
+	subl	$16, %edx
+	movl	$63, %eax
+	movslq	%edx, %rdx
+	vmovd	%eax, %xmm1
+	movl	$-102, %eax
+	addq	%rcx, %rdx
+	vmovd	%eax, %xmm0
+	vpbroadcastb	%xmm1, %xmm1
+	movabsq	$-2242545357980376864, %rax
+	vpaddb	(%rdx), %xmm1, %xmm1
+	vpbroadcastb	%xmm0, %xmm0
+	vmovdqu	(%rdx), %xmm7
+	vpcmpgtb	%xmm1, %xmm0, %xmm0
+	vmovq	%rax, %xmm1
+	vpunpcklqdq	%xmm1, %xmm1, %xmm1
+	vpand	%xmm1, %xmm0, %xmm0
+	vpsubb	%xmm0, %xmm7, %xmm0
+	vmovdqu	%xmm0, (%rdx)
+	ret
+.L405:
+	testl	%esi, %esi
+	jle	.L407
+	leal	-1(%rsi), %eax
+	cmpl	$6, %eax
+	jbe	.L392
+	vmovq	(%rdi), %xmm1
+	vmovq	.LC4(%rip), %xmm0
+	vmovq	.LC5(%rip), %xmm3
+	vmovq	.LC6(%rip), %xmm2
+	vpaddb	%xmm0, %xmm1, %xmm0
+	vpaddb	%xmm2, %xmm1, %xmm2
+	vpsubusb	%xmm3, %xmm0, %xmm0
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpcmpeqb	%xmm3, %xmm0, %xmm0
+	vpblendvb	%xmm0, %xmm2, %xmm1, %xmm1
+	vmovq	%xmm1, (%rdi)
+	cmpl	$8, %esi
+	je	.L407
+	movl	$8, %eax
+	movl	$8, %esi
+.L379:
+	movl	%edx, %edi
+	subl	%eax, %edi
+	leal	-1(%rdi), %r8d
+	cmpl	$2, %r8d
+	jbe	.L382
+	addq	%rcx, %rax
+	vmovd	.LC25(%rip), %xmm0
+	vmovd	.LC26(%rip), %xmm3
+	vmovd	(%rax), %xmm1
+	vmovd	.LC27(%rip), %xmm2
+	vpaddb	%xmm0, %xmm1, %xmm0
+	vpaddb	%xmm2, %xmm1, %xmm2
+	vpsubusb	%xmm3, %xmm0, %xmm0
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpcmpeqb	%xmm3, %xmm0, %xmm0
+	vpblendvb	%xmm0, %xmm2, %xmm1, %xmm1
+	vmovd	%xmm1, (%rax)
+	movl	%edi, %eax
+	andl	$-4, %eax
+	addl	%eax, %esi
+	andl	$3, %edi
+	je	.L407
+.L382:
+	movslq	%esi, %rdi
+	addq	%rcx, %rdi
+	movzbl	(%rdi), %eax
+	leal	-65(%rax), %r9d
+	leal	32(%rax), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %eax
+	movb	%al, (%rdi)
+	leal	1(%rsi), %eax
+	cmpl	%eax, %edx
+	jle	.L407
+	cltq
+	addq	%rcx, %rax
+	movzbl	(%rax), %edi
+	leal	-65(%rdi), %r9d
+	leal	32(%rdi), %r8d
+	cmpb	$26, %r9b
+	cmovb	%r8d, %edi
+	addl	$2, %esi
+	movb	%dil, (%rax)
+	cmpl	%esi, %edx
+	jle	.L407
+	movslq	%esi, %rsi
+	leaq	(%rcx,%rsi), %rax
+	movzbl	(%rax), %edx
+	leal	-65(%rdx), %esi
+	leal	32(%rdx), %ecx
+	cmpb	$26, %sil
+	cmovb	%ecx, %edx
+	movb	%dl, (%rax)
+	ret
+.L406:
+	vzeroupper
+.L407:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L409:
+	vpaddb	(%rcx), %xmm3, %xmm0
+	vmovdqu	(%rcx), %xmm6
+	movl	$16, %eax
+	vpcmpgtb	%xmm0, %xmm2, %xmm0
+	vpand	%xmm1, %xmm0, %xmm0
+	vpsubb	%xmm0, %xmm6, %xmm0
+	vmovdqu	%xmm0, (%rcx)
+	cmpl	$16, %edx
+	jne	.L377
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	jmp	.L379
+	.cfi_endproc
+.LFE13346:
+	.size	_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci, .-_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci
+	.section	.text._ZNSt13random_deviceC2Ev,"axG",@progbits,_ZNSt13random_deviceC5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt13random_deviceC2Ev
+	.type	_ZNSt13random_deviceC2Ev, @function
+_ZNSt13random_deviceC2Ev:
+.LFB2524:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA2524
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+	leaq	16(%rsp), %rbx
+	movq	%rsp, %rsi
+	movl	$1634100580, 16(%rsp)
+	movq	%rbx, (%rsp)
+	movl	$1953264993, 19(%rsp)
+	movq	$7, 8(%rsp)
+	movb	$0, 23(%rsp)
+.LEHB6:
+	call	_ZNSt13random_device7_M_initERKNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEE@PLT
+.LEHE6:
+	movq	(%rsp), %rdi
+	cmpq	%rbx, %rdi
+	je	.L410
+	movq	16(%rsp), %rax
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+.L410:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L414:
+	.cfi_restore_state
+	movq	%rax, %rbp
+.L412:
+	movq	(%rsp), %rdi
+	cmpq	%rbx, %rdi
+	je	.L413
+	movq	16(%rsp), %rax
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+.L413:
+	movq	%rbp, %rdi
+.LEHB7:
+	call	_Unwind_Resume@PLT
+.LEHE7:
+	.cfi_endproc
+.LFE2524:
+	.section	.gcc_except_table
+.LLSDA2524:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE2524-.LLSDACSB2524
+.LLSDACSB2524:
+	.uleb128 .LEHB6-.LFB2524
+	.uleb128 .LEHE6-.LEHB6
+	.uleb128 .L414-.LFB2524
+	.uleb128 0
+	.uleb128 .LEHB7-.LFB2524
+	.uleb128 .LEHE7-.LEHB7
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE2524:
+	.section	.text._ZNSt13random_deviceC2Ev,"axG",@progbits,_ZNSt13random_deviceC5Ev,comdat
+	.size	_ZNSt13random_deviceC2Ev, .-_ZNSt13random_deviceC2Ev
+	.weak	_ZNSt13random_deviceC1Ev
+	.set	_ZNSt13random_deviceC1Ev,_ZNSt13random_deviceC2Ev
+	.section	.rodata._ZN4perf8CountersC2Ev.str1.1,"aMS",@progbits,1
+.LC34:
+	.string	"vector::_M_realloc_insert"
+	.section	.text._ZN4perf8CountersC2Ev,"axG",@progbits,_ZN4perf8CountersC5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN4perf8CountersC2Ev
+	.type	_ZN4perf8CountersC2Ev, @function
+_ZN4perf8CountersC2Ev:
+.LFB12492:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12492
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	xorl	%eax, %eax
+	movl	$15, %ecx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	xorl	%r13d, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	movl	$-1, (%rdi)
+	movups	%xmm0, 8(%rdi)
+	leaq	48(%rsp), %r12
+	leaq	176(%rsp), %r15
+	movups	%xmm0, 24(%rdi)
+	movups	%xmm0, 40(%rdi)
+	leaq	48(%rsp), %rdi
+	rep stosq
+	leaq	192(%rsp), %rax
+	movq	$1, 72(%rsp)
+	movq	$4, 88(%rsp)
+	movq	$5, 104(%rsp)
+	movl	$3, 112(%rsp)
+	movl	$3, 128(%rsp)
+	movq	$65536, 136(%rsp)
+	movq	$2, 152(%rsp)
+	movq	$3, 168(%rsp)
+	movq	%rax, 8(%rsp)
+.L465:
+	movq	8(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$14, %ecx
+	movl	(%rbx), %r8d
+	xorl	%r9d, %r9d
+	xorl	%edx, %edx
+	movq	%r15, %rsi
+	rep stosq
+	movl	(%r12), %eax
+	movl	$-1, %ecx
+	movl	$298, %edi
+	movl	$128, 180(%rsp)
+	movl	%eax, 176(%rsp)
+	movq	8(%r12), %rax
+	movq	$11, 208(%rsp)
+	movq	%rax, 184(%rsp)
+	movl	%r8d, %eax
+	shrl	$31, %eax
+	orl	$96, %eax
+	movb	%al, 216(%rsp)
+	xorl	%eax, %eax
+	call	syscall@PLT
+	movl	%eax, 16(%rsp)
+	movq	%rax, %rbp
+	testl	%eax, %eax
+	js	.L418
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	jns	.L419
+	movl	%ebp, (%rbx)
+.L419:
+	movq	8(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$14, %ecx
+	movl	(%rbx), %r8d
+	xorl	%r9d, %r9d
+	xorl	%edx, %edx
+	movq	%r15, %rsi
+	rep stosq
+	movl	16(%r12), %eax
+	movl	$-1, %ecx
+	movl	$298, %edi
+	movl	$128, 180(%rsp)
+	movl	%eax, 176(%rsp)
+	movq	24(%r12), %rax
+	movq	$11, 208(%rsp)
+	movq	%rax, 184(%rsp)
+	movl	%r8d, %eax
+	shrl	$31, %eax
+	orl	$96, %eax
+	movb	%al, 216(%rsp)
+	xorl	%eax, %eax
+	call	syscall@PLT
+	movq	%rax, %r14
+	testl	%eax, %eax
+	jns	.L420
+	cmpl	%ebp, (%rbx)
+	je	.L418
+	movl	16(%rsp), %edi
+.LEHB8:
+	call	close@PLT
+.L418:
+	addl	$2, %r13d
+	addq	$32, %r12
+	cmpl	$8, %r13d
+	jne	.L465
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	.cfi_restore_state
+	movq	16(%rbx), %rcx
+	movq	24(%rbx), %r8
+	cmpq	%r8, %rcx
+	je	.L422
+	movl	%ebp, (%rcx)
+	addq	$4, %rcx
+	movq	%rcx, 16(%rbx)
+	cmpq	%r8, %rcx
+	je	.L433
+.L511:
+	movl	%r14d, (%rcx)
+	addq	$4, %rcx
+	movq	48(%rbx), %r8
+	movq	%rcx, 16(%rbx)
+	movq	40(%rbx), %rcx
+	cmpq	%r8, %rcx
+	je	.L444
+.L516:
+	movl	%r13d, (%rcx)
+	addq	$4, %rcx
+	leal	1(%r13), %ebp
+	movq	%rcx, 40(%rbx)
+	cmpq	%r8, %rcx
+	je	.L455
+.L521:
+	movl	%ebp, (%rcx)
+	addq	$4, %rcx
+	movq	%rcx, 40(%rbx)
+	jmp	.L418
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	movq	8(%rbx), %rsi
+	movq	%rcx, %rax
+	movabsq	$2305843009213693951, %rdx
+	subq	%rsi, %rax
+	movq	%rsi, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	sarq	$2, %rax
+	cmpq	%rdx, %rax
+	je	.L507
+	cmpq	%rsi, %rcx
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	jc	.L427
+	testq	%rax, %rax
+	jne	.L508
+	xorl	%r8d, %r8d
+	xorl	%r9d, %r9d
+.L429:
+	movq	24(%rsp), %rdx
+	movl	%ebp, (%r9,%rdx)
+	leaq	4(%r9,%rdx), %rcx
+	testq	%rdx, %rdx
+	jg	.L509
+	cmpq	$0, 16(%rsp)
+	jne	.L510
+.L432:
+	movq	%r9, 8(%rbx)
+	movq	%rcx, 16(%rbx)
+	movq	%r8, 24(%rbx)
+	cmpq	%r8, %rcx
+	jne	.L511
+	.p2align 4,,10
+	.p2align 3
+.L433:
+	movq	8(%rbx), %rax
+	movq	%rcx, %rbp
+	movabsq	$2305843009213693951, %rdx
+	subq	%rax, %rbp
+	movq	%rax, 16(%rsp)
+	movq	%rbp, %rax
+	sarq	$2, %rax
+	cmpq	%rdx, %rax
+	je	.L512
+	movq	16(%rsp), %rsi
+	movl	$1, %edx
+	cmpq	%rsi, %rcx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	jc	.L438
+	testq	%rax, %rax
+	jne	.L513
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+.L440:
+	movl	%r14d, (%rcx,%rbp)
+	leaq	4(%rcx,%rbp), %r14
+	testq	%rbp, %rbp
+	jg	.L514
+	cmpq	$0, 16(%rsp)
+	jne	.L515
+.L443:
+	movq	%rcx, 8(%rbx)
+	movq	40(%rbx), %rcx
+	movq	%r8, 24(%rbx)
+	movq	48(%rbx), %r8
+	movq	%r14, 16(%rbx)
+	cmpq	%r8, %rcx
+	jne	.L516
+	.p2align 4,,10
+	.p2align 3
+.L444:
+	movq	32(%rbx), %r14
+	movq	%rcx, %rbp
+	movabsq	$2305843009213693951, %rdx
+	subq	%r14, %rbp
+	movq	%rbp, %rax
+	sarq	$2, %rax
+	cmpq	%rdx, %rax
+	je	.L517
+	cmpq	%r14, %rcx
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	jc	.L449
+	testq	%rax, %rax
+	jne	.L518
+	xorl	%r8d, %r8d
+	xorl	%r9d, %r9d
+.L451:
+	movl	%r13d, (%r9,%rbp)
+	leaq	4(%r9,%rbp), %rcx
+	testq	%rbp, %rbp
+	jg	.L519
+	testq	%r14, %r14
+	jne	.L520
+.L454:
+	movq	%r9, 32(%rbx)
+	leal	1(%r13), %ebp
+	movq	%rcx, 40(%rbx)
+	movq	%r8, 48(%rbx)
+	cmpq	%r8, %rcx
+	jne	.L521
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	movq	32(%rbx), %rax
+	movq	%rcx, %r14
+	movabsq	$2305843009213693951, %rdx
+	subq	%rax, %r14
+	movq	%rax, 16(%rsp)
+	movq	%r14, %rax
+	sarq	$2, %rax
+	cmpq	%rdx, %rax
+	je	.L522
+	movq	16(%rsp), %rsi
+	movl	$1, %edx
+	cmpq	%rsi, %rcx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	jc	.L459
+	testq	%rax, %rax
+	jne	.L523
+	xorl	%r8d, %r8d
+	xorl	%ecx, %ecx
+.L461:
+	movl	%ebp, (%rcx,%r14)
+	leaq	4(%rcx,%r14), %rbp
+	testq	%r14, %r14
+	jg	.L524
+	cmpq	$0, 16(%rsp)
+	jne	.L525
+.L464:
+	movq	%rcx, 32(%rbx)
+	movq	%rbp, 40(%rbx)
+	movq	%r8, 48(%rbx)
+	jmp	.L418
+	.p2align 4,,10
+	.p2align 3
+.L509:
+	movq	16(%rsp), %rbp
+	movq	%r9, %rdi
+	movq	%r8, 32(%rsp)
+	movq	%rcx, 24(%rsp)
+	movq	%rbp, %rsi
+	call	memmove@PLT
+	movq	24(%rsp), %rcx
+	movq	32(%rsp), %r8
+	movq	%rax, %r9
+	movq	24(%rbx), %rax
+	subq	%rbp, %rax
+	movq	%rax, %rsi
+.L431:
+	movq	16(%rsp), %rdi
+	movq	%r9, 40(%rsp)
+	movq	%r8, 32(%rsp)
+	movq	%rcx, 24(%rsp)
+	call	_ZdlPvm@PLT
+	movq	40(%rsp), %r9
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rcx
+	jmp	.L432
+	.p2align 4,,10
+	.p2align 3
+.L514:
+	movq	%rbp, %rdx
+	movq	16(%rsp), %rbp
+	movq	%rcx, %rdi
+	movq	%r8, 24(%rsp)
+	movq	%rbp, %rsi
+	call	memmove@PLT
+	movq	24(%rsp), %r8
+	movq	%rax, %rcx
+	movq	24(%rbx), %rax
+	subq	%rbp, %rax
+	movq	%rax, %rsi
+.L442:
+	movq	16(%rsp), %rdi
+	movq	%rcx, 32(%rsp)
+	movq	%r8, 24(%rsp)
+	call	_ZdlPvm@PLT
+	movq	32(%rsp), %rcx
+	movq	24(%rsp), %r8
+	jmp	.L443
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	movq	%r14, %rsi
+	movq	%r9, %rdi
+	movq	%rbp, %rdx
+	movq	%r8, 24(%rsp)
+	movq	%rcx, 16(%rsp)
+	call	memmove@PLT
+	movq	48(%rbx), %rsi
+	movq	16(%rsp), %rcx
+	movq	24(%rsp), %r8
+	movq	%rax, %r9
+	subq	%r14, %rsi
+.L453:
+	movq	%r14, %rdi
+	movq	%r9, 32(%rsp)
+	movq	%r8, 24(%rsp)
+	movq	%rcx, 16(%rsp)
+	call	_ZdlPvm@PLT
+	movq	32(%rsp), %r9
+	movq	24(%rsp), %r8
+	movq	16(%rsp), %rcx
+	jmp	.L454
+	.p2align 4,,10
+	.p2align 3
+.L524:
+	movq	%r14, %rdx
+	movq	16(%rsp), %r14
+	movq	%rcx, %rdi
+	movq	%r8, 24(%rsp)
+	movq	%r14, %rsi
+	call	memmove@PLT
+	movq	24(%rsp), %r8
+	movq	%rax, %rcx
+	movq	48(%rbx), %rax
+	subq	%r14, %rax
+	movq	%rax, %rsi
+.L463:
+	movq	16(%rsp), %rdi
+	movq	%r8, 32(%rsp)
+	movq	%rcx, 24(%rsp)
+	call	_ZdlPvm@PLT
+	movq	32(%rsp), %r8
+	movq	24(%rsp), %rcx
+	jmp	.L464
+.L518:
+	movabsq	$2305843009213693951, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	salq	$2, %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, %rdi
+.L450:
+	call	_Znwm@PLT
+	movq	16(%rsp), %r8
+	movq	%rax, %r9
+	addq	%rax, %r8
+	jmp	.L451
+.L515:
+	movq	24(%rbx), %rsi
+	movq	16(%rsp), %rax
+	subq	%rax, %rsi
+	jmp	.L442
+.L510:
+	movq	24(%rbx), %rsi
+	movq	16(%rsp), %rax
+	subq	%rax, %rsi
+	jmp	.L431
+.L520:
+	movq	48(%rbx), %rsi
+	subq	%r14, %rsi
+	jmp	.L453
+.L525:
+	movq	48(%rbx), %rsi
+	movq	16(%rsp), %rax
+	subq	%rax, %rsi
+	jmp	.L463
+.L523:
+	movabsq	$2305843009213693951, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	salq	$2, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rdi
+.L460:
+	call	_Znwm@PLT
+	movq	24(%rsp), %r8
+	movq	%rax, %rcx
+	addq	%rax, %r8
+	jmp	.L461
+.L508:
+	movabsq	$2305843009213693951, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	salq	$2, %rax
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+.L428:
+	call	_Znwm@PLT
+	movq	32(%rsp), %r8
+	movq	%rax, %r9
+	addq	%rax, %r8
+	jmp	.L429
+.L513:
+	movabsq	$2305843009213693951, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	salq	$2, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rdi
+.L439:
+	call	_Znwm@PLT
+	movq	24(%rsp), %r8
+	movq	%rax, %rcx
+	addq	%rax, %r8
+	jmp	.L440
+.L459:
+	movabsq	$9223372036854775804, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rdi
+	jmp	.L460
+.L522:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L512:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L438:
+	movabsq	$9223372036854775804, %rax
+	movq	%rax, 24(%rsp)
+	movq	%rax, %rdi
+	jmp	.L439
+.L517:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L449:
+	movabsq	$9223372036854775804, %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, %rdi
+	jmp	.L450
+.L507:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE8:
+.L427:
+	movabsq	$9223372036854775804, %rax
+	movq	%rax, 32(%rsp)
+	movq	%rax, %rdi
+	jmp	.L428
+.L481:
+	movq	%rax, %rbp
+.L466:
+	movq	32(%rbx), %rdi
+	movq	48(%rbx), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L467
+	call	_ZdlPvm@PLT
+.L467:
+	movq	8(%rbx), %rdi
+	movq	24(%rbx), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L468
+	call	_ZdlPvm@PLT
+.L468:
+	movq	%rbp, %rdi
+.LEHB9:
+	call	_Unwind_Resume@PLT
+.LEHE9:
+	.cfi_endproc
+.LFE12492:
+	.section	.gcc_except_table
+.LLSDA12492:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE12492-.LLSDACSB12492
+.LLSDACSB12492:
+	.uleb128 .LEHB8-.LFB12492
+	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .L481-.LFB12492
+	.uleb128 0
+	.uleb128 .LEHB9-.LFB12492
+	.uleb128 .LEHE9-.LEHB9
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE12492:
+	.section	.text._ZN4perf8CountersC2Ev,"axG",@progbits,_ZN4perf8CountersC5Ev,comdat
+	.size	_ZN4perf8CountersC2Ev, .-_ZN4perf8CountersC2Ev
+	.weak	_ZN4perf8CountersC1Ev
+	.set	_ZN4perf8CountersC1Ev,_ZN4perf8CountersC2Ev
+	.section	.text._ZN10StringPoolC2Ev,"axG",@progbits,_ZN10StringPoolC5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN10StringPoolC2Ev
+	.type	_ZN10StringPoolC2Ev, @function
+_ZN10StringPoolC2Ev:
+.LFB12638:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12638
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pxor	%xmm0, %xmm0
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	movups	%xmm0, (%rdi)
+	movups	%xmm0, 16(%rdi)
+	movups	%xmm0, 32(%rdi)
+	movl	$8, %edi
+.LEHB10:
+	call	_Znwm@PLT
+.LEHE10:
+	leaq	8(%rax), %rdx
+	movq	%rax, 24(%rbx)
+	movq	%rdx, 40(%rbx)
+	movq	$0, (%rax)
+	movq	%rdx, 32(%rbx)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.L530:
+	.cfi_restore_state
+	movq	%rax, %rbp
+.L527:
+	movq	24(%rbx), %rdi
+	movq	40(%rbx), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L528
+	call	_ZdlPvm@PLT
+.L528:
+	movq	(%rbx), %rdi
+	movq	16(%rbx), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L529
+	call	_ZdlPvm@PLT
+.L529:
+	movq	%rbp, %rdi
+.LEHB11:
+	call	_Unwind_Resume@PLT
+.LEHE11:
+	.cfi_endproc
+.LFE12638:
+	.section	.gcc_except_table
+.LLSDA12638:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE12638-.LLSDACSB12638
+.LLSDACSB12638:
+	.uleb128 .LEHB10-.LFB12638
+	.uleb128 .LEHE10-.LEHB10
+	.uleb128 .L530-.LFB12638
+	.uleb128 0
+	.uleb128 .LEHB11-.LFB12638
+	.uleb128 .LEHE11-.LEHB11
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE12638:
+	.section	.text._ZN10StringPoolC2Ev,"axG",@progbits,_ZN10StringPoolC5Ev,comdat
+	.size	_ZN10StringPoolC2Ev, .-_ZN10StringPoolC2Ev
+	.weak	_ZN10StringPoolC1Ev
+	.set	_ZN10StringPoolC1Ev,_ZN10StringPoolC2Ev
+	.section	.text._ZN10StringPoolD2Ev,"axG",@progbits,_ZN10StringPoolD5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZN10StringPoolD2Ev
+	.type	_ZN10StringPoolD2Ev, @function
+_ZN10StringPoolD2Ev:
+.LFB12734:
+	.cfi_startproc
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	movq	24(%rdi), %rdi
+	testq	%rdi, %rdi
+	je	.L540
+	movq	40(%rbx), %rsi
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+.L540:
+	movq	(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L539
+	movq	16(%rbx), %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	subq	%rdi, %rsi
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L539:
+	.cfi_restore_state
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12734:
+	.size	_ZN10StringPoolD2Ev, .-_ZN10StringPoolD2Ev
+	.weak	_ZN10StringPoolD1Ev
+	.set	_ZN10StringPoolD1Ev,_ZN10StringPoolD2Ev
+	.section	.text._ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev,"axG",@progbits,_ZNSt6vectorI12AsciiKernelsSaIS0_EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev
+	.type	_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev, @function
+_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev:
+.LFB13356:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	(%rdi), %rbx
+	cmpq	%rbx, %rbp
+	je	.L547
+	.p2align 4,,10
+	.p2align 3
+.L551:
+	movq	(%rbx), %rdi
+	leaq	16(%rbx), %rax
+	cmpq	%rax, %rdi
+	je	.L548
+	movq	16(%rbx), %rax
+	addq	$56, %rbx
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L551
+.L550:
+	movq	(%r12), %rbx
+.L547:
+	testq	%rbx, %rbx
+	je	.L546
+	movq	16(%r12), %rsi
+	movq	%rbx, %rdi
+	subq	%rbx, %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L548:
+	.cfi_restore_state
+	addq	$56, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L551
+	jmp	.L550
+	.p2align 4,,10
+	.p2align 3
+.L546:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13356:
+	.size	_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev, .-_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev
+	.weak	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev
+	.set	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev,_ZNSt6vectorI12AsciiKernelsSaIS0_EED2Ev
+	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
+	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev, @function
+_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev:
+.LFB13434:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	(%rdi), %rbx
+	cmpq	%rbx, %rbp
+	je	.L555
+	.p2align 4,,10
+	.p2align 3
+.L559:
+	movq	(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L556
+	movq	16(%rbx), %rsi
+	addq	$24, %rbx
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L559
+.L558:
+	movq	(%r12), %rbx
+.L555:
+	testq	%rbx, %rbx
+	je	.L554
+	movq	16(%r12), %rsi
+	movq	%rbx, %rdi
+	subq	%rbx, %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L556:
+	.cfi_restore_state
+	addq	$24, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L559
+	jmp	.L558
+	.p2align 4,,10
+	.p2align 3
+.L554:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13434:
+	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
+	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
+	.set	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev,_ZNSt6vectorIS_IcSaIcEESaIS1_EED2Ev
+	.section	.rodata._ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_.str1.8,"aMS",@progbits,1
+	.align 8
+.LC35:
+	.string	"cannot create std::vector larger than max_size()"
+	.section	.rodata._ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_.str1.1,"aMS",@progbits,1
+.LC36:
+	.string	"basic_string::_M_create"
+	.section	.text._ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_,"axG",@progbits,_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC5ESt16initializer_listISA_ERKSB_,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_
+	.type	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_, @function
+_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_:
+.LFB13489:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA13489
+	movabsq	$9223372036854775800, %rax
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	(%rdx,%rdx,4), %rbx
+	salq	$3, %rbx
+	leaq	(%rsi,%rbx), %r14
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	movq	$0, 16(%rdi)
+	movups	%xmm0, (%rdi)
+	cmpq	%rbx, %rax
+	jb	.L594
+	testq	%rbx, %rbx
+	je	.L564
+	movq	%rbx, %rdi
+	movq	%rsi, %rbp
+	movq	%rsi, %r12
+.LEHB12:
+	call	_Znwm@PLT
+.LEHE12:
+	addq	%rax, %rbx
+	movq	%rax, (%rsp)
+	movq	%rax, (%r15)
+	movq	%rbx, 16(%r15)
+	cmpq	%r14, %rbp
+	je	.L581
+	movq	%rax, %rbx
+	jmp	.L573
+	.p2align 4,,10
+	.p2align 3
+.L566:
+	cmpq	$1, %rbp
+	jne	.L570
+	movzbl	0(%r13), %eax
+	movb	%al, 16(%rbx)
+.L571:
+	movq	%rbp, 8(%rbx)
+	addq	$40, %r12
+	addq	$40, %rbx
+	movb	$0, (%rdi,%rbp)
+	movq	-8(%r12), %rax
+	movq	%rax, -8(%rbx)
+	cmpq	%r12, %r14
+	je	.L565
+.L573:
+	movq	8(%r12), %rbp
+	leaq	16(%rbx), %rdi
+	movq	(%r12), %r13
+	movq	%rdi, (%rbx)
+	cmpq	$15, %rbp
+	jbe	.L566
+	testq	%rbp, %rbp
+	js	.L595
+	movq	%rbp, %rdi
+	addq	$1, %rdi
+	js	.L596
+.LEHB13:
+	call	_Znwm@PLT
+	movq	%rax, (%rbx)
+	movq	%rax, %rdi
+	movq	%rbp, 16(%rbx)
+.L569:
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	movq	(%rbx), %rdi
+	jmp	.L571
+	.p2align 4,,10
+	.p2align 3
+.L570:
+	testq	%rbp, %rbp
+	je	.L571
+	jmp	.L569
+	.p2align 4,,10
+	.p2align 3
+.L564:
+	movq	$0, (%rdi)
+	xorl	%ebx, %ebx
+	movq	$0, 16(%rdi)
+.L565:
+	movq	%rbx, 8(%r15)
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L596:
+	.cfi_restore_state
+	call	_ZSt17__throw_bad_allocv@PLT
+.L595:
+	leaq	.LC36(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE13:
+.L594:
+	leaq	.LC35(%rip), %rdi
+.LEHB14:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE14:
+.L581:
+	movq	(%rsp), %rbx
+	jmp	.L565
+.L584:
+	movq	%rax, %rdi
+	jmp	.L574
+.L582:
+	movq	%rax, %rbx
+	jmp	.L579
+.L574:
+	call	__cxa_begin_catch@PLT
+.L575:
+	movq	(%rsp), %rax
+	cmpq	%rax, %rbx
+	je	.L597
+	movq	(%rsp), %rax
+	movq	(%rax), %rdi
+	addq	$16, %rax
+	cmpq	%rax, %rdi
+	je	.L576
+	movq	(%rsp), %rax
+	movq	16(%rax), %rax
+	leaq	1(%rax), %rsi
+	movq	%rax, 8(%rsp)
+	call	_ZdlPvm@PLT
+.L576:
+	addq	$40, (%rsp)
+	jmp	.L575
+.L578:
+	call	__cxa_end_catch@PLT
+.L579:
+	movq	(%r15), %rdi
+	movq	16(%r15), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L580
+	call	_ZdlPvm@PLT
+.L580:
+	movq	%rbx, %rdi
+.LEHB15:
+	call	_Unwind_Resume@PLT
+.LEHE15:
+.L597:
+.LEHB16:
+	call	__cxa_rethrow@PLT
+.LEHE16:
+.L583:
+	movq	%rax, %rbx
+	jmp	.L578
+	.cfi_endproc
+.LFE13489:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA13489:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT13489-.LLSDATTD13489
+.LLSDATTD13489:
+	.byte	0x1
+	.uleb128 .LLSDACSE13489-.LLSDACSB13489
+.LLSDACSB13489:
+	.uleb128 .LEHB12-.LFB13489
+	.uleb128 .LEHE12-.LEHB12
+	.uleb128 .L582-.LFB13489
+	.uleb128 0
+	.uleb128 .LEHB13-.LFB13489
+	.uleb128 .LEHE13-.LEHB13
+	.uleb128 .L584-.LFB13489
+	.uleb128 0x1
+	.uleb128 .LEHB14-.LFB13489
+	.uleb128 .LEHE14-.LEHB14
+	.uleb128 .L582-.LFB13489
+	.uleb128 0
+	.uleb128 .LEHB15-.LFB13489
+	.uleb128 .LEHE15-.LEHB15
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB16-.LFB13489
+	.uleb128 .LEHE16-.LEHB16
+	.uleb128 .L583-.LFB13489
+	.uleb128 0
+.LLSDACSE13489:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT13489:
+	.section	.text._ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_,"axG",@progbits,_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC5ESt16initializer_listISA_ERKSB_,comdat
+	.size	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_, .-_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_
+	.weak	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC1ESt16initializer_listISA_ERKSB_
+	.set	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC1ESt16initializer_listISA_ERKSB_,_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC2ESt16initializer_listISA_ERKSB_
+	.section	.text._ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev,"axG",@progbits,_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED5Ev,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev
+	.type	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev, @function
+_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev:
+.LFB13492:
+	.cfi_startproc
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	8(%rdi), %rbp
+	movq	(%rdi), %rbx
+	cmpq	%rbx, %rbp
+	je	.L599
+	.p2align 4,,10
+	.p2align 3
+.L603:
+	movq	(%rbx), %rdi
+	leaq	16(%rbx), %rax
+	cmpq	%rax, %rdi
+	je	.L600
+	movq	16(%rbx), %rax
+	addq	$40, %rbx
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L603
+.L602:
+	movq	(%r12), %rbx
+.L599:
+	testq	%rbx, %rbx
+	je	.L598
+	movq	16(%r12), %rsi
+	movq	%rbx, %rdi
+	subq	%rbx, %rsi
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	jmp	_ZdlPvm@PLT
+	.p2align 4,,10
+	.p2align 3
+.L600:
+	.cfi_restore_state
+	addq	$40, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L603
+	jmp	.L602
+	.p2align 4,,10
+	.p2align 3
+.L598:
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13492:
+	.size	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev, .-_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev
+	.weak	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED1Ev
+	.set	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED1Ev,_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED2Ev
+	.section	.text._ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_,"axG",@progbits,_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_,comdat
+	.p2align 4
+	.weak	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+	.type	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_, @function
+_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_:
+.LFB14247:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpq	%rsi, %rdi
+	je	.L606
+	.p2align 4,,10
+	.p2align 3
+.L610:
+	movq	(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L608
+	movq	16(%rbx), %rsi
+	addq	$24, %rbx
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L610
+.L606:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L608:
+	.cfi_restore_state
+	addq	$24, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L610
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14247:
+	.size	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_, .-_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+	.section	.text.unlikely
+	.align 2
+.LCOLDB37:
+	.text
+.LHOTB37:
+	.align 2
+	.p2align 4
+	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0, @function
+_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0:
+.LFB14833:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA14833
+	cmpq	%rdi, %rsi
+	je	.L701
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rsi, %rcx
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	8(%rsi), %r14
+	movq	(%rsi), %rbx
+	movq	(%rdi), %rbp
+	movq	16(%rdi), %rax
+	movq	%r14, %rdx
+	subq	%rbx, %rdx
+	subq	%rbp, %rax
+	movq	%rdx, 8(%rsp)
+	cmpq	%rdx, %rax
+	jb	.L707
+	movq	8(%rdi), %r15
+	movq	%r15, %r12
+	subq	%rbp, %r12
+	movq	%r12, %rax
+	cmpq	%rdx, %r12
+	jnb	.L633
+	testq	%r12, %r12
+	jle	.L635
+	movabsq	$-6148914691236517205, %rax
+	sarq	$3, %r12
+	imulq	%rax, %r12
+	jmp	.L659
+	.p2align 4,,10
+	.p2align 3
+.L711:
+	testq	%r14, %r14
+	jne	.L708
+.L655:
+	movq	%rdi, 8(%rbp)
+.L651:
+	addq	$24, %rbx
+	addq	$24, %rbp
+	subq	$1, %r12
+	je	.L709
+.L659:
+	cmpq	%rbx, %rbp
+	je	.L651
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	0(%rbp), %rdi
+	movq	16(%rbp), %rax
+	movq	%rdx, %r14
+	subq	%rsi, %r14
+	subq	%rdi, %rax
+	cmpq	%r14, %rax
+	jb	.L710
+	movq	8(%rbp), %rax
+	movq	%rax, %r8
+	subq	%rdi, %r8
+	cmpq	%r14, %r8
+	jnb	.L711
+	xorl	%r9d, %r9d
+	testq	%r8, %r8
+	jne	.L712
+	addq	%r9, %rsi
+	subq	%rsi, %rdx
+	jne	.L658
+.L722:
+	addq	%r14, %rdi
+	jmp	.L655
+	.p2align 4,,10
+	.p2align 3
+.L710:
+	movq	%rcx, 24(%rsp)
+	movq	%rsi, 16(%rsp)
+	testq	%r14, %r14
+	js	.L653
+	movq	%r14, %rdi
+.LEHB17:
+	call	_Znwm@PLT
+	movq	16(%rsp), %rsi
+	movq	%r14, %rdx
+	movq	%rax, %rdi
+	movq	%rax, %r15
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	movq	24(%rsp), %rcx
+	testq	%rdi, %rdi
+	je	.L654
+	movq	16(%rbp), %rsi
+	movq	%rcx, 16(%rsp)
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	movq	16(%rsp), %rcx
+.L654:
+	leaq	(%r15,%r14), %rdi
+	movq	%r15, 0(%rbp)
+	movq	%rdi, 16(%rbp)
+	jmp	.L655
+	.p2align 4,,10
+	.p2align 3
+.L701:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L633:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	testq	%rdx, %rdx
+	jle	.L636
+	movabsq	$-6148914691236517205, %rax
+	movq	%rdx, %r14
+	sarq	$3, %r14
+	imulq	%rax, %r14
+	jmp	.L645
+	.p2align 4,,10
+	.p2align 3
+.L715:
+	testq	%r12, %r12
+	jne	.L713
+.L641:
+	movq	%rdi, 8(%rbp)
+.L637:
+	addq	$24, %rbx
+	addq	$24, %rbp
+	subq	$1, %r14
+	je	.L636
+.L645:
+	cmpq	%rbp, %rbx
+	je	.L637
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	0(%rbp), %rdi
+	movq	16(%rbp), %rax
+	movq	%rdx, %r12
+	subq	%rsi, %r12
+	subq	%rdi, %rax
+	cmpq	%r12, %rax
+	jb	.L714
+	movq	8(%rbp), %rax
+	movq	%rax, %rcx
+	subq	%rdi, %rcx
+	cmpq	%r12, %rcx
+	jnb	.L715
+	xorl	%r8d, %r8d
+	testq	%rcx, %rcx
+	jne	.L716
+.L643:
+	addq	%r8, %rsi
+	subq	%rsi, %rdx
+	jne	.L644
+	addq	%r12, %rdi
+	jmp	.L641
+	.p2align 4,,10
+	.p2align 3
+.L714:
+	testq	%r12, %r12
+	js	.L653
+	movq	%r12, %rdi
+	movq	%rsi, 16(%rsp)
+	call	_Znwm@PLT
+.LEHE17:
+	movq	16(%rsp), %rsi
+	movq	%r12, %rdx
+	movq	%rax, %rdi
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	movq	%rax, %rcx
+	testq	%rdi, %rdi
+	je	.L640
+	movq	16(%rbp), %rsi
+	movq	%rax, 16(%rsp)
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	movq	16(%rsp), %rcx
+.L640:
+	leaq	(%rcx,%r12), %rdi
+	movq	%rcx, 0(%rbp)
+	movq	%rdi, 16(%rbp)
+	jmp	.L641
+	.p2align 4,,10
+	.p2align 3
+.L636:
+	cmpq	%rbp, %r15
+	je	.L646
+	.p2align 4,,10
+	.p2align 3
+.L650:
+	movq	0(%rbp), %rdi
+	testq	%rdi, %rdi
+	je	.L647
+	movq	16(%rbp), %rsi
+	addq	$24, %rbp
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbp, %r15
+	jne	.L650
+.L646:
+	movq	8(%rsp), %rax
+	addq	0(%r13), %rax
+.L632:
+	movq	%rax, 8(%r13)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L647:
+	.cfi_restore_state
+	addq	$24, %rbp
+	cmpq	%rbp, %r15
+	jne	.L650
+	jmp	.L646
+	.p2align 4,,10
+	.p2align 3
+.L709:
+	movq	8(%r13), %r15
+	movq	0(%r13), %rbp
+	movq	8(%rcx), %r14
+	movq	(%rcx), %rbx
+	movq	%r15, %rax
+	subq	%rbp, %rax
+.L635:
+	addq	%rax, %rbx
+	movq	%r15, %r12
+	cmpq	%r14, %rbx
+	jne	.L660
+	movq	8(%rsp), %rax
+	addq	%rbp, %rax
+	jmp	.L632
+	.p2align 4,,10
+	.p2align 3
+.L718:
+	js	.L717
+	movq	%rbp, %rdi
+.LEHB18:
+	call	_Znwm@PLT
+.LEHE18:
+	movq	%rax, %rcx
+.L661:
+	movq	%rcx, %xmm0
+	addq	%rcx, %rbp
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rbp, 16(%r12)
+	movups	%xmm0, (%r12)
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rbp
+	subq	%rsi, %rbp
+	jne	.L663
+.L706:
+	addq	$24, %rbx
+	movq	%rcx, 8(%r12)
+	addq	$24, %r12
+	cmpq	%r14, %rbx
+	je	.L646
+.L660:
+	movq	8(%rbx), %rbp
+	pxor	%xmm2, %xmm2
+	subq	(%rbx), %rbp
+	movq	$0, 16(%r12)
+	movups	%xmm2, (%r12)
+	jne	.L718
+	xorl	%ecx, %ecx
+	jmp	.L661
+	.p2align 4,,10
+	.p2align 3
+.L663:
+	movq	%rcx, %rdi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+	movq	%rax, %rcx
+	addq	%rbp, %rcx
+	jmp	.L706
+	.p2align 4,,10
+	.p2align 3
+.L707:
+	movabsq	$9223372036854775800, %rax
+	cmpq	%rdx, %rax
+	jb	.L719
+	movq	%rdx, %rdi
+.LEHB19:
+	call	_Znwm@PLT
+.LEHE19:
+	movq	%rax, %r15
+	movq	%rax, %r12
+	cmpq	%rbx, %r14
+	jne	.L624
+	jmp	.L623
+	.p2align 4,,10
+	.p2align 3
+.L721:
+	js	.L720
+	movq	%rbp, %rdi
+.LEHB20:
+	call	_Znwm@PLT
+	movq	%rax, %rcx
+.L619:
+	movq	%rcx, %xmm0
+	addq	%rcx, %rbp
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rbp, 16(%r12)
+	movups	%xmm0, (%r12)
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rbp
+	subq	%rsi, %rbp
+	jne	.L621
+.L705:
+	addq	$24, %rbx
+	movq	%rcx, 8(%r12)
+	addq	$24, %r12
+	cmpq	%rbx, %r14
+	je	.L623
+.L624:
+	movq	8(%rbx), %rbp
+	pxor	%xmm1, %xmm1
+	subq	(%rbx), %rbp
+	movq	$0, 16(%r12)
+	movups	%xmm1, (%r12)
+	jne	.L721
+	xorl	%ecx, %ecx
+	jmp	.L619
+	.p2align 4,,10
+	.p2align 3
+.L621:
+	movq	%rcx, %rdi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+	movq	%rax, %rcx
+	addq	%rbp, %rcx
+	jmp	.L705
+	.p2align 4,,10
+	.p2align 3
+.L623:
+	movq	8(%r13), %rbp
+	movq	0(%r13), %rbx
+	cmpq	%rbx, %rbp
+	je	.L618
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	movq	(%rbx), %rdi
+	testq	%rdi, %rdi
+	je	.L628
+	movq	16(%rbx), %rsi
+	addq	$24, %rbx
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L617
+.L630:
+	movq	0(%r13), %rbx
+.L618:
+	testq	%rbx, %rbx
+	je	.L631
+	movq	16(%r13), %rsi
+	movq	%rbx, %rdi
+	subq	%rbx, %rsi
+	call	_ZdlPvm@PLT
+.L631:
+	movq	8(%rsp), %rax
+	movq	%r15, 0(%r13)
+	addq	%r15, %rax
+	movq	%rax, 16(%r13)
+	jmp	.L632
+	.p2align 4,,10
+	.p2align 3
+.L628:
+	addq	$24, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L617
+	jmp	.L630
+	.p2align 4,,10
+	.p2align 3
+.L712:
+	movq	%r8, %rdx
+	movq	%rcx, 16(%rsp)
+	call	memmove@PLT
+	movq	8(%rbp), %rax
+	movq	0(%rbp), %rdi
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rdx
+	movq	%rax, %r9
+	movq	16(%rsp), %rcx
+	subq	%rdi, %r9
+	addq	%r9, %rsi
+	subq	%rsi, %rdx
+	je	.L722
+.L658:
+	movq	%rax, %rdi
+	movq	%rcx, 16(%rsp)
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	movq	16(%rsp), %rcx
+	addq	%r14, %rdi
+	jmp	.L655
+	.p2align 4,,10
+	.p2align 3
+.L708:
+	movq	%r14, %rdx
+	movq	%rcx, 16(%rsp)
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	movq	16(%rsp), %rcx
+	addq	%r14, %rdi
+	jmp	.L655
+	.p2align 4,,10
+	.p2align 3
+.L644:
+	movq	%rax, %rdi
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	addq	%r12, %rdi
+	jmp	.L641
+	.p2align 4,,10
+	.p2align 3
+.L716:
+	movq	%rcx, %rdx
+	call	memmove@PLT
+	movq	8(%rbp), %rax
+	movq	0(%rbp), %rdi
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	%rax, %r8
+	subq	%rdi, %r8
+	jmp	.L643
+	.p2align 4,,10
+	.p2align 3
+.L713:
+	movq	%r12, %rdx
+	call	memmove@PLT
+	movq	0(%rbp), %rdi
+	addq	%r12, %rdi
+	jmp	.L641
+	.p2align 4,,10
+	.p2align 3
+.L720:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE20:
+	.p2align 4,,10
+	.p2align 3
+.L717:
+.LEHB21:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE21:
+	.p2align 4,,10
+	.p2align 3
+.L653:
+.LEHB22:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L719:
+	call	_ZSt28__throw_bad_array_new_lengthv@PLT
+.LEHE22:
+.L676:
+	movq	%rax, %rdi
+	jmp	.L666
+.L675:
+	movq	%rax, %rdi
+	jmp	.L625
+	.section	.gcc_except_table
+	.align 4
+.LLSDA14833:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT14833-.LLSDATTD14833
+.LLSDATTD14833:
+	.byte	0x1
+	.uleb128 .LLSDACSE14833-.LLSDACSB14833
+.LLSDACSB14833:
+	.uleb128 .LEHB17-.LFB14833
+	.uleb128 .LEHE17-.LEHB17
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB18-.LFB14833
+	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .L676-.LFB14833
+	.uleb128 0x1
+	.uleb128 .LEHB19-.LFB14833
+	.uleb128 .LEHE19-.LEHB19
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB20-.LFB14833
+	.uleb128 .LEHE20-.LEHB20
+	.uleb128 .L675-.LFB14833
+	.uleb128 0x1
+	.uleb128 .LEHB21-.LFB14833
+	.uleb128 .LEHE21-.LEHB21
+	.uleb128 .L676-.LFB14833
+	.uleb128 0x1
+	.uleb128 .LEHB22-.LFB14833
+	.uleb128 .LEHE22-.LEHB22
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE14833:
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x7d
+	.align 4
+	.long	0
+
+.LLSDATT14833:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC14833
+	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0.cold, @function
+_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0.cold:
+.LFSB14833:
+.L666:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	call	__cxa_begin_catch@PLT
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+.LEHB23:
+	call	__cxa_rethrow@PLT
+.LEHE23:
+.L625:
+	call	__cxa_begin_catch@PLT
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+.LEHB24:
+	call	__cxa_rethrow@PLT
+.LEHE24:
+.L677:
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.LEHB25:
+	call	_Unwind_Resume@PLT
+.LEHE25:
+.L674:
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+	call	__cxa_begin_catch@PLT
+	movq	8(%rsp), %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.LEHB26:
+	call	__cxa_rethrow@PLT
+.LEHE26:
+.L673:
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.LEHB27:
+	call	_Unwind_Resume@PLT
+.LEHE27:
+	.cfi_endproc
+.LFE14833:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC14833:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC14833-.LLSDATTDC14833
+.LLSDATTDC14833:
+	.byte	0x1
+	.uleb128 .LLSDACSEC14833-.LLSDACSBC14833
+.LLSDACSBC14833:
+	.uleb128 .LEHB23-.LCOLDB37
+	.uleb128 .LEHE23-.LEHB23
+	.uleb128 .L677-.LCOLDB37
+	.uleb128 0
+	.uleb128 .LEHB24-.LCOLDB37
+	.uleb128 .LEHE24-.LEHB24
+	.uleb128 .L674-.LCOLDB37
+	.uleb128 0x3
+	.uleb128 .LEHB25-.LCOLDB37
+	.uleb128 .LEHE25-.LEHB25
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB26-.LCOLDB37
+	.uleb128 .LEHE26-.LEHB26
+	.uleb128 .L673-.LCOLDB37
+	.uleb128 0
+	.uleb128 .LEHB27-.LCOLDB37
+	.uleb128 .LEHE27-.LEHB27
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC14833:
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x7d
+	.align 4
+	.long	0
+
+.LLSDATTC14833:
+	.section	.text.unlikely
+	.text
+	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0
+	.section	.text.unlikely
+	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0.cold, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0.cold
+.LCOLDE37:
+	.text
+.LHOTE37:
+	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_
+	.type	_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_, @function
+_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_:
+.LFB12721:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12721
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	movq	8(%rsi), %rbx
+	subq	(%rsi), %rbx
+	movups	%xmm0, (%rdi)
+	movq	$0, 16(%rdi)
+	je	.L735
+	movabsq	$9223372036854775800, %rax
+	cmpq	%rbx, %rax
+	jb	.L746
+	movq	%rbx, %rdi
+.LEHB28:
+	call	_Znwm@PLT
+.LEHE28:
+	movq	%rax, %r15
+.L724:
+	movq	%r15, %xmm0
+	addq	%r15, %rbx
+	movq	%r15, %r12
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rbx, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	movq	8(%rbp), %r14
+	movq	0(%rbp), %rbx
+	cmpq	%r14, %rbx
+	jne	.L731
+	jmp	.L726
+	.p2align 4,,10
+	.p2align 3
+.L748:
+	js	.L747
+	movq	%rbp, %rdi
+.LEHB29:
+	call	_Znwm@PLT
+	movq	%rax, %rcx
+.L727:
+	movq	%rcx, %xmm0
+	addq	%rcx, %rbp
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rbp, 16(%r12)
+	movups	%xmm0, (%r12)
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rbp
+	subq	%rsi, %rbp
+	jne	.L729
+.L745:
+	addq	$24, %rbx
+	movq	%rcx, 8(%r12)
+	addq	$24, %r12
+	cmpq	%rbx, %r14
+	je	.L726
+.L731:
+	movq	8(%rbx), %rbp
+	pxor	%xmm1, %xmm1
+	subq	(%rbx), %rbp
+	movq	$0, 16(%r12)
+	movups	%xmm1, (%r12)
+	jne	.L748
+	xorl	%ecx, %ecx
+	jmp	.L727
+	.p2align 4,,10
+	.p2align 3
+.L729:
+	movq	%rcx, %rdi
+	movq	%rbp, %rdx
+	call	memmove@PLT
+	movq	%rax, %rcx
+	addq	%rbp, %rcx
+	jmp	.L745
+	.p2align 4,,10
+	.p2align 3
+.L726:
+	movq	%r12, 8(%r13)
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L735:
+	.cfi_restore_state
+	xorl	%r15d, %r15d
+	jmp	.L724
+	.p2align 4,,10
+	.p2align 3
+.L747:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE29:
+.L746:
+.LEHB30:
+	call	_ZSt28__throw_bad_array_new_lengthv@PLT
+.LEHE30:
+.L739:
+	movq	%rax, %rdi
+.L732:
+	call	__cxa_begin_catch@PLT
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+.LEHB31:
+	call	__cxa_rethrow@PLT
+.LEHE31:
+.L738:
+	movq	%rax, %rbx
+.L733:
+	call	__cxa_end_catch@PLT
+	movq	0(%r13), %rdi
+	movq	16(%r13), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L734
+	call	_ZdlPvm@PLT
+.L734:
+	movq	%rbx, %rdi
+.LEHB32:
+	call	_Unwind_Resume@PLT
+.LEHE32:
+	.cfi_endproc
+.LFE12721:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA12721:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT12721-.LLSDATTD12721
+.LLSDATTD12721:
+	.byte	0x1
+	.uleb128 .LLSDACSE12721-.LLSDACSB12721
+.LLSDACSB12721:
+	.uleb128 .LEHB28-.LFB12721
+	.uleb128 .LEHE28-.LEHB28
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB29-.LFB12721
+	.uleb128 .LEHE29-.LEHB29
+	.uleb128 .L739-.LFB12721
+	.uleb128 0x1
+	.uleb128 .LEHB30-.LFB12721
+	.uleb128 .LEHE30-.LEHB30
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB31-.LFB12721
+	.uleb128 .LEHE31-.LEHB31
+	.uleb128 .L738-.LFB12721
+	.uleb128 0
+	.uleb128 .LEHB32-.LFB12721
+	.uleb128 .LEHE32-.LEHB32
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE12721:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT12721:
+	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_,comdat
+	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_
+	.section	.text._ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_,"axG",@progbits,_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_,comdat
+	.p2align 4
+	.weak	_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_
+	.type	_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_, @function
+_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_:
+.LFB14361:
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	cmpq	%rsi, %rdi
+	je	.L749
+	.p2align 4,,10
+	.p2align 3
+.L753:
+	movq	(%rbx), %rdi
+	leaq	16(%rbx), %rax
+	cmpq	%rax, %rdi
+	je	.L751
+	movq	16(%rbx), %rax
+	addq	$56, %rbx
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%rbx, %rbp
+	jne	.L753
+.L749:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L751:
+	.cfi_restore_state
+	addq	$56, %rbx
+	cmpq	%rbx, %rbp
+	jne	.L753
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14361:
+	.size	_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_, .-_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_
+	.section	.text._ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_,"axG",@progbits,_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_
+	.type	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_, @function
+_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_:
+.LFB13358:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA13358
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	8(%rdi), %rbx
+	cmpq	16(%rdi), %rbx
+	je	.L756
+	movq	8(%rsi), %r13
+	leaq	16(%rbx), %rdi
+	movq	%rdi, (%rbx)
+	movq	(%rsi), %r14
+	cmpq	$15, %r13
+	ja	.L807
+	cmpq	$1, %r13
+	jne	.L761
+	movzbl	(%r14), %eax
+	movb	%al, 16(%rbx)
+.L762:
+	movq	%r13, 8(%rbx)
+	movb	$0, (%rdi,%r13)
+	movdqu	32(%r12), %xmm1
+	movq	48(%r12), %rax
+	movups	%xmm1, 32(%rbx)
+	movq	%rax, 48(%rbx)
+	addq	$56, 8(%rbp)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L807:
+	.cfi_restore_state
+	testq	%r13, %r13
+	js	.L808
+	movq	%r13, %rdi
+	addq	$1, %rdi
+	js	.L809
+.LEHB33:
+	call	_Znwm@PLT
+	movq	%r13, 16(%rbx)
+	movq	%rax, (%rbx)
+	movq	%rax, %rdi
+.L760:
+	movq	%r13, %rdx
+	movq	%r14, %rsi
+	call	memcpy@PLT
+	movq	(%rbx), %rdi
+	jmp	.L762
+	.p2align 4,,10
+	.p2align 3
+.L756:
+	movabsq	$7905747460161236407, %rdx
+	movq	(%rdi), %r14
+	movq	%rbx, %r13
+	subq	%r14, %r13
+	movq	%r13, %rax
+	sarq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$164703072086692425, %rdx
+	cmpq	%rdx, %rax
+	je	.L810
+	cmpq	%r14, %rbx
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	movq	%rax, 8(%rsp)
+	jc	.L789
+	testq	%rax, %rax
+	jne	.L811
+	movq	$0, (%rsp)
+.L770:
+	movq	(%rsp), %rax
+	movq	8(%r12), %r15
+	addq	%rax, %r13
+	leaq	16(%r13), %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, 0(%r13)
+	movq	(%r12), %rax
+	movq	%rax, 24(%rsp)
+	cmpq	$15, %r15
+	ja	.L812
+	cmpq	$1, %r15
+	je	.L813
+	testq	%r15, %r15
+	jne	.L814
+.L776:
+	movq	16(%rsp), %rax
+	movq	%r15, 8(%r13)
+	movb	$0, (%rax,%r15)
+	movdqu	32(%r12), %xmm2
+	movq	48(%r12), %rax
+	movups	%xmm2, 32(%r13)
+	movq	%rax, 48(%r13)
+	cmpq	%r14, %rbx
+	je	.L791
+	movq	(%rsp), %r13
+	movq	%r14, %r12
+	jmp	.L781
+	.p2align 4,,10
+	.p2align 3
+.L779:
+	movq	16(%r12), %rax
+	movq	%rsi, 0(%r13)
+	movq	%rax, 16(%r13)
+	movq	8(%r12), %rax
+.L780:
+	movq	%rax, 8(%r13)
+	movq	48(%r12), %rax
+	addq	$56, %r12
+	addq	$56, %r13
+	movdqu	-24(%r12), %xmm0
+	movq	%rax, -8(%r13)
+	movups	%xmm0, -24(%r13)
+	cmpq	%r12, %rbx
+	je	.L815
+.L781:
+	leaq	16(%r13), %rdi
+	leaq	16(%r12), %rax
+	movq	%rdi, 0(%r13)
+	movq	(%r12), %rsi
+	cmpq	%rax, %rsi
+	jne	.L779
+	movq	8(%r12), %rdx
+	movq	$-1, %rax
+	addq	$1, %rdx
+	je	.L780
+	call	memcpy@PLT
+	movq	8(%r12), %rax
+	jmp	.L780
+	.p2align 4,,10
+	.p2align 3
+.L761:
+	testq	%r13, %r13
+	je	.L762
+	jmp	.L760
+	.p2align 4,,10
+	.p2align 3
+.L789:
+	movabsq	$9223372036854775800, %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rdi
+.L769:
+	call	_Znwm@PLT
+.LEHE33:
+	movq	%rax, (%rsp)
+	jmp	.L770
+	.p2align 4,,10
+	.p2align 3
+.L815:
+	movabsq	$988218432520154551, %rdx
+	leaq	-56(%rbx), %rax
+	subq	%r14, %rax
+	shrq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$2305843009213693951, %rdx
+	andq	%rdx, %rax
+	addq	$1, %rax
+	leaq	0(,%rax,8), %rdx
+	subq	%rax, %rdx
+	movq	(%rsp), %rax
+	leaq	(%rax,%rdx,8), %rbx
+.L778:
+	addq	$56, %rbx
+	testq	%r14, %r14
+	je	.L782
+	movq	16(%rbp), %rsi
+	movq	%r14, %rdi
+	subq	%r14, %rsi
+	call	_ZdlPvm@PLT
+.L782:
+	movq	(%rsp), %rcx
+	movq	8(%rsp), %rax
+	movq	%rbx, 8(%rbp)
+	addq	%rcx, %rax
+	movq	%rcx, 0(%rbp)
+	movq	%rax, 16(%rbp)
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L812:
+	.cfi_restore_state
+	testq	%r15, %r15
+	js	.L816
+	movq	%r15, %rdi
+	addq	$1, %rdi
+	js	.L817
+.LEHB34:
+	call	_Znwm@PLT
+.LEHE34:
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	movq	%r15, 16(%r13)
+.L774:
+	movq	24(%rsp), %rsi
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	movq	0(%r13), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L776
+	.p2align 4,,10
+	.p2align 3
+.L813:
+	movzbl	(%rax), %eax
+	movb	%al, 16(%r13)
+	jmp	.L776
+	.p2align 4,,10
+	.p2align 3
+.L791:
+	movq	(%rsp), %rbx
+	jmp	.L778
+.L809:
+.LEHB35:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE35:
+.L814:
+	movq	16(%rsp), %rdi
+	jmp	.L774
+.L817:
+.LEHB36:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L811:
+	movq	%rax, %rcx
+	movabsq	$164703072086692425, %rax
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	leaq	0(,%rax,8), %rdx
+	subq	%rax, %rdx
+	leaq	0(,%rdx,8), %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rdi
+	jmp	.L769
+.L816:
+	leaq	.LC36(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE36:
+.L808:
+	leaq	.LC36(%rip), %rdi
+.LEHB37:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L810:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE37:
+.L794:
+	movq	%rax, %rdi
+.L783:
+	call	__cxa_begin_catch@PLT
+	cmpq	$0, (%rsp)
+	je	.L818
+	movq	(%rsp), %rbx
+	movq	%rbx, %rsi
+	movq	%rbx, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_ZdlPvm@PLT
+.L786:
+.LEHB38:
+	call	__cxa_rethrow@PLT
+.LEHE38:
+.L818:
+	movq	0(%r13), %rdi
+	movq	16(%rsp), %rax
+	cmpq	%rax, %rdi
+	je	.L786
+	movq	16(%r13), %rsi
+	addq	$1, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L786
+.L793:
+	movq	%rax, %rbx
+.L787:
+	call	__cxa_end_catch@PLT
+	movq	%rbx, %rdi
+.LEHB39:
+	call	_Unwind_Resume@PLT
+.LEHE39:
+	.cfi_endproc
+.LFE13358:
+	.section	.gcc_except_table
+	.align 4
+.LLSDA13358:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT13358-.LLSDATTD13358
+.LLSDATTD13358:
+	.byte	0x1
+	.uleb128 .LLSDACSE13358-.LLSDACSB13358
+.LLSDACSB13358:
+	.uleb128 .LEHB33-.LFB13358
+	.uleb128 .LEHE33-.LEHB33
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB34-.LFB13358
+	.uleb128 .LEHE34-.LEHB34
+	.uleb128 .L794-.LFB13358
+	.uleb128 0x1
+	.uleb128 .LEHB35-.LFB13358
+	.uleb128 .LEHE35-.LEHB35
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB36-.LFB13358
+	.uleb128 .LEHE36-.LEHB36
+	.uleb128 .L794-.LFB13358
+	.uleb128 0x1
+	.uleb128 .LEHB37-.LFB13358
+	.uleb128 .LEHE37-.LEHB37
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB38-.LFB13358
+	.uleb128 .LEHE38-.LEHB38
+	.uleb128 .L793-.LFB13358
+	.uleb128 0
+	.uleb128 .LEHB39-.LFB13358
+	.uleb128 .LEHE39-.LEHB39
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE13358:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT13358:
+	.section	.text._ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_,"axG",@progbits,_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_,comdat
+	.size	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_, .-_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_
+	.section	.text.unlikely
+.LCOLDB38:
+	.text
+.LHOTB38:
+	.p2align 4
+	.globl	_Z17supported_kernelsv
+	.type	_Z17supported_kernelsv, @function
+_Z17supported_kernelsv:
+.LFB12588:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12588
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pxor	%xmm0, %xmm0
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	$0, 16(%rdi)
+	movups	%xmm0, (%rdi)
+	call	__cpu_indicator_init@PLT
+	movq	__cpu_model@GOTPCREL(%rip), %rbx
+	movl	12(%rbx), %eax
+	testl	$2097152, %eax
+	jne	.L885
+.L820:
+	testb	$4, %ah
+	jne	.L886
+.L821:
+	testb	$16, %al
+	je	.L822
+	leaq	_ZL12sse2_kernels(%rip), %rsi
+	movq	%rbp, %rdi
+.LEHB40:
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_
+.L822:
+	movq	8(%rbp), %rbx
+	cmpq	16(%rbp), %rbx
+	je	.L823
+	movq	8+_ZL14scalar_kernels(%rip), %r12
+	leaq	16(%rbx), %rdi
+	movq	%rdi, (%rbx)
+	movq	_ZL14scalar_kernels(%rip), %r13
+	cmpq	$15, %r12
+	ja	.L887
+	cmpq	$1, %r12
+	jne	.L828
+	movzbl	0(%r13), %eax
+	movb	%al, 16(%rbx)
+.L829:
+	movq	%r12, 8(%rbx)
+	movb	$0, (%rdi,%r12)
+	movdqa	32+_ZL14scalar_kernels(%rip), %xmm2
+	movq	48+_ZL14scalar_kernels(%rip), %rax
+	movups	%xmm2, 32(%rbx)
+	movq	%rax, 48(%rbx)
+	addq	$56, 8(%rbp)
+.L819:
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L887:
+	.cfi_restore_state
+	testq	%r12, %r12
+	js	.L888
+	movq	%r12, %rdi
+	addq	$1, %rdi
+	js	.L889
+	call	_Znwm@PLT
+	movq	%rax, (%rbx)
+	movq	%rax, %rdi
+	movq	%r12, 16(%rbx)
+.L827:
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	movq	(%rbx), %rdi
+	jmp	.L829
+	.p2align 4,,10
+	.p2align 3
+.L886:
+	leaq	_ZL12avx2_kernels(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_
+	movl	12(%rbx), %eax
+	jmp	.L821
+	.p2align 4,,10
+	.p2align 3
+.L885:
+	leaq	_ZL14avx512_kernels(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EE9push_backERKS0_
+	movl	12(%rbx), %eax
+	jmp	.L820
+	.p2align 4,,10
+	.p2align 3
+.L823:
+	movq	0(%rbp), %r14
+	movq	%rbx, %r12
+	movabsq	$7905747460161236407, %rdx
+	subq	%r14, %r12
+	movq	%r12, %rax
+	sarq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$164703072086692425, %rdx
+	cmpq	%rdx, %rax
+	je	.L890
+	cmpq	%r14, %rbx
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	movq	%rax, 8(%rsp)
+	jc	.L857
+	testq	%rax, %rax
+	jne	.L891
+	xorl	%r13d, %r13d
+.L837:
+	addq	%r13, %r12
+	movq	8+_ZL14scalar_kernels(%rip), %r15
+	leaq	16(%r12), %rax
+	movq	%rax, 16(%rsp)
+	movq	%rax, (%r12)
+	movq	_ZL14scalar_kernels(%rip), %rax
+	movq	%rax, 24(%rsp)
+	cmpq	$15, %r15
+	ja	.L892
+	cmpq	$1, %r15
+	je	.L893
+	testq	%r15, %r15
+	jne	.L894
+.L843:
+	movq	16(%rsp), %rax
+	movq	%r15, 8(%r12)
+	movb	$0, (%rax,%r15)
+	movdqa	32+_ZL14scalar_kernels(%rip), %xmm3
+	movq	48+_ZL14scalar_kernels(%rip), %rax
+	movups	%xmm3, 32(%r12)
+	movq	%rax, 48(%r12)
+	cmpq	%r14, %rbx
+	je	.L859
+	movq	%r14, %r12
+	movq	%r13, %r15
+	jmp	.L848
+	.p2align 4,,10
+	.p2align 3
+.L846:
+	movq	16(%r12), %rax
+	movq	%rsi, (%r15)
+	movq	%rax, 16(%r15)
+	movq	8(%r12), %rax
+.L847:
+	movq	%rax, 8(%r15)
+	movq	48(%r12), %rax
+	addq	$56, %r12
+	addq	$56, %r15
+	movdqu	-24(%r12), %xmm1
+	movq	%rax, -8(%r15)
+	movups	%xmm1, -24(%r15)
+	cmpq	%r12, %rbx
+	je	.L895
+.L848:
+	leaq	16(%r15), %rdi
+	leaq	16(%r12), %rax
+	movq	%rdi, (%r15)
+	movq	(%r12), %rsi
+	cmpq	%rax, %rsi
+	jne	.L846
+	movq	8(%r12), %rdx
+	movq	$-1, %rax
+	addq	$1, %rdx
+	je	.L847
+	call	memcpy@PLT
+	movq	8(%r12), %rax
+	jmp	.L847
+	.p2align 4,,10
+	.p2align 3
+.L828:
+	testq	%r12, %r12
+	je	.L829
+	jmp	.L827
+	.p2align 4,,10
+	.p2align 3
+.L857:
+	movabsq	$9223372036854775800, %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rdi
+.L836:
+	call	_Znwm@PLT
+.LEHE40:
+	movq	%rax, %r13
+	jmp	.L837
+	.p2align 4,,10
+	.p2align 3
+.L895:
+	movabsq	$988218432520154551, %rdx
+	leaq	-56(%rbx), %rax
+	subq	%r14, %rax
+	shrq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$2305843009213693951, %rdx
+	andq	%rdx, %rax
+	addq	$1, %rax
+	leaq	0(,%rax,8), %rdx
+	subq	%rax, %rdx
+	leaq	0(%r13,%rdx,8), %rbx
+.L845:
+	addq	$56, %rbx
+	testq	%r14, %r14
+	je	.L849
+	movq	16(%rbp), %rsi
+	movq	%r14, %rdi
+	subq	%r14, %rsi
+	call	_ZdlPvm@PLT
+.L849:
+	movq	8(%rsp), %rax
+	movq	%r13, 0(%rbp)
+	movq	%rbx, 8(%rbp)
+	addq	%rax, %r13
+	movq	%r13, 16(%rbp)
+	jmp	.L819
+	.p2align 4,,10
+	.p2align 3
+.L892:
+	testq	%r15, %r15
+	js	.L896
+	movq	%r15, %rdi
+	addq	$1, %rdi
+	js	.L897
+.LEHB41:
+	call	_Znwm@PLT
+.LEHE41:
+	movq	%rax, (%r12)
+	movq	%rax, %rdi
+	movq	%r15, 16(%r12)
+.L841:
+	movq	24(%rsp), %rsi
+	movq	%r15, %rdx
+	call	memcpy@PLT
+	movq	(%r12), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L843
+	.p2align 4,,10
+	.p2align 3
+.L893:
+	movzbl	(%rax), %eax
+	movb	%al, 16(%r12)
+	jmp	.L843
+	.p2align 4,,10
+	.p2align 3
+.L859:
+	movq	%r13, %rbx
+	jmp	.L845
+.L889:
+.LEHB42:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE42:
+.L894:
+	movq	16(%rsp), %rdi
+	jmp	.L841
+.L897:
+.LEHB43:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L891:
+	movq	%rax, %rcx
+	movabsq	$164703072086692425, %rax
+	cmpq	%rax, %rcx
+	cmovbe	%rcx, %rax
+	leaq	0(,%rax,8), %rdx
+	subq	%rax, %rdx
+	leaq	0(,%rdx,8), %rax
+	movq	%rax, 8(%rsp)
+	movq	%rax, %rdi
+	jmp	.L836
+.L896:
+	leaq	.LC36(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE43:
+.L888:
+	leaq	.LC36(%rip), %rdi
+.LEHB44:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L890:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE44:
+.L861:
+	movq	%rax, %rbx
+	jmp	.L855
+.L863:
+	movq	%rax, %rdi
+	jmp	.L850
+	.section	.gcc_except_table
+	.align 4
+.LLSDA12588:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT12588-.LLSDATTD12588
+.LLSDATTD12588:
+	.byte	0x1
+	.uleb128 .LLSDACSE12588-.LLSDACSB12588
+.LLSDACSB12588:
+	.uleb128 .LEHB40-.LFB12588
+	.uleb128 .LEHE40-.LEHB40
+	.uleb128 .L861-.LFB12588
+	.uleb128 0
+	.uleb128 .LEHB41-.LFB12588
+	.uleb128 .LEHE41-.LEHB41
+	.uleb128 .L863-.LFB12588
+	.uleb128 0x1
+	.uleb128 .LEHB42-.LFB12588
+	.uleb128 .LEHE42-.LEHB42
+	.uleb128 .L861-.LFB12588
+	.uleb128 0
+	.uleb128 .LEHB43-.LFB12588
+	.uleb128 .LEHE43-.LEHB43
+	.uleb128 .L863-.LFB12588
+	.uleb128 0x1
+	.uleb128 .LEHB44-.LFB12588
+	.uleb128 .LEHE44-.LEHB44
+	.uleb128 .L861-.LFB12588
+	.uleb128 0
+.LLSDACSE12588:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT12588:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC12588
+	.type	_Z17supported_kernelsv.cold, @function
+_Z17supported_kernelsv.cold:
+.LFSB12588:
+	nop
+.L862:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	movq	%rax, %rbx
+	call	__cxa_end_catch@PLT
+.L855:
+	movq	%rbp, %rdi
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev
+	movq	%rbx, %rdi
+.LEHB45:
+	call	_Unwind_Resume@PLT
+.LEHE45:
+.L850:
+	call	__cxa_begin_catch@PLT
+	testq	%r13, %r13
+	je	.L898
+	movq	%r13, %rsi
+	movq	%r13, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIP12AsciiKernelsEEvT_S4_
+	movq	8(%rsp), %rsi
+	movq	%r13, %rdi
+	call	_ZdlPvm@PLT
+.L853:
+.LEHB46:
+	call	__cxa_rethrow@PLT
+.LEHE46:
+.L898:
+	movq	(%r12), %rdi
+	movq	16(%rsp), %rax
+	cmpq	%rax, %rdi
+	je	.L853
+	movq	16(%r12), %rsi
+	addq	$1, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L853
+	.cfi_endproc
+.LFE12588:
+	.section	.gcc_except_table
+	.align 4
+.LLSDAC12588:
+	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC12588-.LLSDATTDC12588
+.LLSDATTDC12588:
+	.byte	0x1
+	.uleb128 .LLSDACSEC12588-.LLSDACSBC12588
+.LLSDACSBC12588:
+	.uleb128 .LEHB45-.LCOLDB38
+	.uleb128 .LEHE45-.LEHB45
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB46-.LCOLDB38
+	.uleb128 .LEHE46-.LEHB46
+	.uleb128 .L862-.LCOLDB38
+	.uleb128 0
+.LLSDACSEC12588:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATTC12588:
+	.section	.text.unlikely
+	.text
+	.size	_Z17supported_kernelsv, .-_Z17supported_kernelsv
+	.section	.text.unlikely
+	.size	_Z17supported_kernelsv.cold, .-_Z17supported_kernelsv.cold
+.LCOLDE38:
+	.text
+.LHOTE38:
+	.section	.text.unlikely
+.LCOLDB39:
+	.text
+.LHOTB39:
+	.p2align 4
+	.globl	_Z14select_kernelsv
+	.type	_Z14select_kernelsv, @function
+_Z14select_kernelsv:
+.LFB12617:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12617
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 80
+	movq	%rsp, %r14
+	movq	%r14, %rdi
+.LEHB47:
+	call	_Z17supported_kernelsv
+.LEHE47:
+	movq	(%rsp), %r12
+	leaq	16(%rbp), %rdi
+	movq	%rdi, 0(%rbp)
+	movq	8(%r12), %rbx
+	movq	(%r12), %r13
+	cmpq	$15, %rbx
+	ja	.L920
+	cmpq	$1, %rbx
+	jne	.L904
+	movzbl	0(%r13), %eax
+	movb	%al, 16(%rbp)
+.L905:
+	movq	%rbx, 8(%rbp)
+	movq	8(%rsp), %r13
+	movb	$0, (%rdi,%rbx)
+	movdqu	32(%r12), %xmm0
+	movq	%r12, %rbx
+	movq	48(%r12), %rax
+	movups	%xmm0, 32(%rbp)
+	movq	%rax, 48(%rbp)
+	cmpq	%r13, %r12
+	je	.L910
+	.p2align 4,,10
+	.p2align 3
+.L907:
+	movq	(%rbx), %rdi
+	leaq	16(%rbx), %rax
+	cmpq	%rax, %rdi
+	je	.L908
+	movq	16(%rbx), %rax
+	addq	$56, %rbx
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	cmpq	%r13, %rbx
+	jne	.L907
+.L910:
+	movq	16(%rsp), %rsi
+	movq	%r12, %rdi
+	subq	%r12, %rsi
+	call	_ZdlPvm@PLT
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L904:
+	.cfi_restore_state
+	testq	%rbx, %rbx
+	je	.L905
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	call	memcpy@PLT
+	movq	0(%rbp), %rdi
+	jmp	.L905
+	.p2align 4,,10
+	.p2align 3
+.L908:
+	addq	$56, %rbx
+	cmpq	%rbx, %r13
+	jne	.L907
+	jmp	.L910
+	.p2align 4,,10
+	.p2align 3
+.L920:
+	testq	%rbx, %rbx
+	js	.L921
+	movq	%rbx, %rdi
+	addq	$1, %rdi
+	js	.L922
+.LEHB48:
+	call	_Znwm@PLT
+	movq	%rax, 0(%rbp)
+	movq	%rax, %rdi
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movq	%rbx, 16(%rbp)
+	call	memcpy@PLT
+	movq	0(%rbp), %rdi
+	jmp	.L905
+.L922:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L921:
+	leaq	.LC36(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE48:
+.L913:
+	movq	%rax, %rbx
+	jmp	.L911
+	.section	.gcc_except_table
+.LLSDA12617:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE12617-.LLSDACSB12617
+.LLSDACSB12617:
+	.uleb128 .LEHB47-.LFB12617
+	.uleb128 .LEHE47-.LEHB47
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB48-.LFB12617
+	.uleb128 .LEHE48-.LEHB48
+	.uleb128 .L913-.LFB12617
+	.uleb128 0
+.LLSDACSE12617:
+	.text
+	.cfi_endproc
+	.section	.text.unlikely
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC12617
+	.type	_Z14select_kernelsv.cold, @function
+_Z14select_kernelsv.cold:
+.LFSB12617:
+.L911:
+	.cfi_def_cfa_offset 80
+	.cfi_offset 3, -48
+	.cfi_offset 6, -40
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+	.cfi_offset 14, -16
+	movq	%r14, %rdi
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev
+	movq	%rbx, %rdi
+.LEHB49:
+	call	_Unwind_Resume@PLT
+.LEHE49:
+	.cfi_endproc
+.LFE12617:
+	.section	.gcc_except_table
+.LLSDAC12617:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSEC12617-.LLSDACSBC12617
+.LLSDACSBC12617:
+	.uleb128 .LEHB49-.LCOLDB39
+	.uleb128 .LEHE49-.LEHB49
+	.uleb128 0
+	.uleb128 0
+.LLSDACSEC12617:
+	.section	.text.unlikely
+	.text
+	.size	_Z14select_kernelsv, .-_Z14select_kernelsv
+	.section	.text.unlikely
+	.size	_Z14select_kernelsv.cold, .-_Z14select_kernelsv.cold
+.LCOLDE39:
+	.text
+.LHOTE39:
+	.section	.text._ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv,"axG",@progbits,_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv,comdat
+	.align 2
+	.p2align 4
+	.weak	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	.type	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv, @function
+_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv:
+.LFB14413:
+	.cfi_startproc
+	movq	%rdi, %r8
+	movq	(%rdi), %rdi
+	movl	$2567483615, %r10d
+	movq	%r8, %rax
+	leaq	1816(%r8), %r9
+	movq	%r8, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L925:
+	andq	$-2147483648, %rdi
+	movq	%rdi, %rcx
+	movq	8(%rdx), %rdi
+	movq	%rdi, %rsi
+	andl	$2147483647, %esi
+	orq	%rcx, %rsi
+	movq	%rsi, %rcx
+	shrq	%rcx
+	xorq	3176(%rdx), %rcx
+	andl	$1, %esi
+	je	.L924
+	xorq	%r10, %rcx
+.L924:
+	movq	%rcx, (%rdx)
+	addq	$8, %rdx
+	cmpq	%r9, %rdx
+	jne	.L925
+	movq	1816(%r8), %rsi
+	leaq	3168(%r8), %rdi
+	movl	$2567483615, %r9d
+	.p2align 4,,10
+	.p2align 3
+.L927:
+	andq	$-2147483648, %rsi
+	movq	%rsi, %rdx
+	movq	1824(%rax), %rsi
+	movq	%rsi, %rcx
+	andl	$2147483647, %ecx
+	orq	%rdx, %rcx
+	movq	%rcx, %rdx
+	shrq	%rdx
+	xorq	(%rax), %rdx
+	andl	$1, %ecx
+	je	.L926
+	xorq	%r9, %rdx
+.L926:
+	movq	%rdx, 1816(%rax)
+	addq	$8, %rax
+	cmpq	%rdi, %rax
+	jne	.L927
+	movq	4984(%r8), %rax
+	movq	(%r8), %rdx
+	andq	$-2147483648, %rax
+	andl	$2147483647, %edx
+	orq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	%rdx
+	xorq	3168(%r8), %rdx
+	testb	$1, %al
+	je	.L928
+	movl	$2567483615, %eax
+	xorq	%rax, %rdx
+.L928:
+	movq	%rdx, 4984(%r8)
+	movq	$0, 4992(%r8)
+	ret
+	.cfi_endproc
+.LFE14413:
+	.size	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv, .-_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	.text
+	.align 2
+	.p2align 4
+	.type	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0, @function
+_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0:
+.LFB14844:
+	.cfi_startproc
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movslq	%esi, %rax
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movslq	%edx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	subq	%rax, %r13
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rax, %rbp
+	movl	$4294967294, %eax
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	cmpq	%r13, %rax
+	jnb	.L957
+	movl	$4294967295, %eax
+	cmpq	%rax, %r13
+	je	.L947
+.L955:
+	movl	$-1, %edx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
+	movq	%rax, %rbx
+	movq	4992(%r12), %rax
+	salq	$32, %rbx
+	cmpq	$623, %rax
+	jbe	.L948
+	movq	%r12, %rdi
+	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	movq	4992(%r12), %rax
+.L948:
+	leaq	1(%rax), %rdx
+	movq	(%r12,%rax,8), %rax
+	movq	%rdx, 4992(%r12)
+	movq	%rax, %rdx
+	shrq	$11, %rdx
+	movl	%edx, %edx
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	salq	$7, %rdx
+	andl	$2636928640, %edx
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	salq	$15, %rdx
+	andl	$4022730752, %edx
+	xorq	%rdx, %rax
+	movq	%rax, %rdx
+	shrq	$18, %rdx
+	xorq	%rdx, %rax
+	addq	%rax, %rbx
+	setc	%al
+	movzbl	%al, %eax
+	cmpq	%rbx, %r13
+	jb	.L955
+	testq	%rax, %rax
+	jne	.L955
+.L946:
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	leal	0(%rbp,%rbx), %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
 	.cfi_def_cfa_offset 40
 	popq	%r12
 	.cfi_def_cfa_offset 32
@@ -654,832 +6207,2813 @@ _ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__norm
 	ret
 	.p2align 4,,10
 	.p2align 3
-.L84:
-	.cfi_restore_state
-	movq	%rcx, %rdi
-	movq	%rdx, 16(%rsp)
-	call	memmove
-	movq	16(%rsp), %rdx
+.L957:
+	.cfi_restore_state
+	movq	4992(%rdi), %rax
+	addq	$1, %r13
+	movl	%r13d, %r15d
+	cmpq	$623, %rax
+	ja	.L958
+.L942:
+	movq	(%r12,%rax,8), %rbx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 4992(%r12)
+	movq	%rbx, %rax
+	shrq	$11, %rax
+	movl	%eax, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$7, %rax
+	andl	$2636928640, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$15, %rax
+	andl	$4022730752, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	shrq	$18, %rax
+	xorq	%rax, %rbx
+	imulq	%r13, %rbx
+	cmpl	%r13d, %ebx
+	jnb	.L943
+	movl	%r13d, %eax
+	xorl	%edx, %edx
+	negl	%eax
+	divl	%r15d
+	movl	%edx, %r14d
+	cmpl	%edx, %ebx
+	jb	.L945
+	jmp	.L943
+	.p2align 4,,10
+	.p2align 3
+.L944:
+	movq	(%r12,%rax,8), %rbx
+	leaq	1(%rax), %rcx
+	movq	%rcx, 4992(%r12)
+	movq	%rbx, %rax
+	shrq	$11, %rax
+	movl	%eax, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$7, %rax
+	andl	$2636928640, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$15, %rax
+	andl	$4022730752, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	shrq	$18, %rax
+	xorq	%rax, %rbx
+	imulq	%r13, %rbx
+	cmpl	%r14d, %ebx
+	jnb	.L943
+.L945:
+	movq	%rcx, %rax
+	cmpq	$623, %rcx
+	jbe	.L944
+	movq	%r12, %rdi
+	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	movq	4992(%r12), %rax
+	jmp	.L944
+	.p2align 4,,10
+	.p2align 3
+.L943:
+	shrq	$32, %rbx
+	jmp	.L946
+	.p2align 4,,10
+	.p2align 3
+.L947:
+	movq	4992(%rdi), %rax
+	cmpq	$623, %rax
+	ja	.L959
+.L952:
+	movq	(%r12,%rax,8), %rbx
+	leaq	1(%rax), %rdx
+	movq	%rdx, 4992(%r12)
+	movq	%rbx, %rax
+	shrq	$11, %rax
+	movl	%eax, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$7, %rax
+	andl	$2636928640, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	salq	$15, %rax
+	andl	$4022730752, %eax
+	xorq	%rax, %rbx
+	movq	%rbx, %rax
+	shrq	$18, %rax
+	xorq	%rax, %rbx
+	jmp	.L946
+	.p2align 4,,10
+	.p2align 3
+.L958:
+	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	movq	4992(%r12), %rax
+	jmp	.L942
+	.p2align 4,,10
+	.p2align 3
+.L959:
+	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
+	movq	4992(%r12), %rax
+	jmp	.L952
+	.cfi_endproc
+.LFE14844:
+	.size	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0, .-_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC41:
+	.string	"PASSED"
+.LC42:
+	.string	"FAILED"
+.LC43:
+	.string	"vector::reserve"
+.LC53:
+	.string	" kernels test: "
+.LC54:
+	.string	"Selected kernels: "
+.LC55:
+	.string	"vector::_M_range_insert"
+.LC56:
+	.string	"toupper_branchless"
+.LC57:
+	.string	"toupper_standard"
+.LC58:
+	.string	"toupper_simd"
+.LC59:
+	.string	"tolower_simd"
+.LC60:
+	.string	"[GB/s]"
+.LC61:
+	.string	"copies"
+.LC62:
+	.string	"in place"
+.LC63:
+	.string	"string pool"
+.LC64:
+	.string	"whole pool"
+.LC67:
+	.string	": "
+.LC68:
+	.string	" [ms]"
+.LC69:
+	.string	"  "
+.LC70:
+	.string	"IPC"
+.LC71:
+	.string	" "
+.LC72:
+	.string	""
+.LC73:
+	.string	"n/a"
+.LC74:
+	.string	"branch misses"
+.LC76:
+	.string	"%"
+.LC77:
+	.string	"L1d misses"
+.LC78:
+	.string	"LLC misses"
+.LC79:
+	.string	"all_alnum_scalar"
+.LC80:
+	.string	"all_alnum"
+.LC81:
+	.string	" [GB/s] ("
+.LC82:
+	.string	" alphanumeric)"
+	.section	.text.unlikely
+.LCOLDB86:
+	.section	.text.startup,"ax",@progbits
+.LHOTB86:
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB12690:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA12690
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$10712, %rsp
+	.cfi_def_cfa_offset 10768
+	leaq	688(%rsp), %rax
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	movq	%rax, 56(%rsp)
+.LEHB50:
+	call	_ZNSt13random_deviceC1Ev
+.LEHE50:
+	movq	%rbx, %rdi
+.LEHB51:
+	call	_ZNSt13random_device9_M_getvalEv@PLT
+.LEHE51:
+	movl	%eax, %eax
+	movl	$1, %ecx
+	leaq	5696(%rsp), %r14
+	movq	%rax, 5696(%rsp)
+	movq	%rax, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L961:
+	movq	%rdx, %rax
+	shrq	$30, %rax
+	xorq	%rdx, %rax
+	imulq	$1812433253, %rax, %rax
+	leal	(%rax,%rcx), %edx
+	movq	%rdx, (%r14,%rcx,8)
+	addq	$1, %rcx
+	cmpq	$624, %rcx
+	jne	.L961
+	pxor	%xmm0, %xmm0
+	movl	$2400000, %edi
+	movq	$624, 10688(%rsp)
+	leaq	192(%rsp), %rbx
+	movq	$0, 208(%rsp)
+	movaps	%xmm0, 192(%rsp)
+.LEHB52:
+	call	_Znwm@PLT
+.LEHE52:
+	movq	200(%rsp), %rcx
+	movq	192(%rsp), %rdi
+	movq	%rax, %xmm0
+	movq	%rax, %rbx
+	punpcklqdq	%xmm0, %xmm0
+	cmpq	%rdi, %rcx
+	je	.L968
+	leaq	-24(%rcx), %rax
+	movq	%rdi, %rdx
+	movabsq	$768614336404564651, %rsi
+	subq	%rdi, %rax
+	shrq	$3, %rax
+	imulq	%rsi, %rax
+	movabsq	$2305843009213693951, %rsi
+	andq	%rsi, %rax
+	je	.L1271
+	movq	%rbx, %rsi
+	subq	%rdi, %rsi
+	subq	$8, %rsi
+	cmpq	$32, %rsi
+	ja	.L1513
+.L1271:
+	movq	%rdi, %rax
+	movq	%rbx, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L970:
+	movdqu	(%rax), %xmm2
+	movq	16(%rax), %rsi
+	addq	$24, %rax
+	addq	$24, %rdx
+	movups	%xmm2, -24(%rdx)
+	movq	%rsi, -8(%rdx)
+	cmpq	%rax, %rcx
+	jne	.L970
+.L968:
+	testq	%rdi, %rdi
+	je	.L964
+	movq	208(%rsp), %rsi
+	movaps	%xmm0, (%rsp)
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	movdqa	(%rsp), %xmm0
+.L964:
+	addq	$2400000, %rbx
+	movl	$100000, 48(%rsp)
+	movq	%rbx, 208(%rsp)
+	movaps	%xmm0, 192(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L1013:
+	movl	$50, %edx
+	movl	$5, %esi
+	movq	%r14, %rdi
+	call	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
+	movslq	%eax, %r15
+	movq	%r15, %r13
+	testl	%r15d, %r15d
+	js	.L1514
+	testq	%r15, %r15
+	jne	.L1515
+	movq	200(%rsp), %rbx
+	cmpq	%rbx, 208(%rsp)
+	jne	.L983
+	movq	$0, (%rsp)
+	xorl	%ebp, %ebp
+	movq	$0, 24(%rsp)
+.L984:
+	movq	192(%rsp), %r13
+	movq	%rbx, %r12
+	movabsq	$-6148914691236517205, %rdi
+	movabsq	$384307168202282325, %rsi
+	subq	%r13, %r12
+	movq	%r12, %rax
+	sarq	$3, %rax
+	imulq	%rdi, %rax
+	cmpq	%rsi, %rax
+	je	.L1516
+	cmpq	%rbx, %r13
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	movq	%rax, 40(%rsp)
+	jc	.L1275
+	testq	%rax, %rax
+	jne	.L1517
+	movq	$0, 32(%rsp)
+.L994:
+	movq	32(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	addq	%rax, %r12
+	movq	24(%rsp), %rax
+	movq	$0, 16(%r12)
+	movups	%xmm0, (%r12)
+	subq	%rax, %rbp
+	je	.L995
+	js	.L1518
+	movq	%rbp, %rdi
+.LEHB53:
+	call	_Znwm@PLT
+.LEHE53:
+	leaq	(%rax,%rbp), %rcx
+	movq	%rax, (%r12)
+	movq	24(%rsp), %rsi
+	movq	%rax, %rdi
+	movq	%rcx, 16(%r12)
+	movq	%rbp, %rdx
+	movq	%rcx, (%rsp)
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+.L997:
+	movq	%rcx, 8(%r12)
+	cmpq	%rbx, %r13
+	je	.L1277
+	movq	%rbx, %rax
+	movq	%r13, %rcx
+	subq	%r13, %rax
+	leaq	-24(%rax), %rdx
+	movabsq	$768614336404564651, %rax
+	shrq	$3, %rdx
+	imulq	%rax, %rdx
+	movabsq	$2305843009213693951, %rax
+	movq	%rdx, %rsi
+	andq	%rax, %rsi
+	je	.L1278
+	movq	32(%rsp), %r11
+	movq	%r11, %rax
+	movq	%r11, %rdx
+	subq	%r13, %rax
+	leaq	-8(%rax), %rdi
+	movq	%r13, %rax
+	cmpq	$32, %rdi
+	ja	.L1519
+	.p2align 4,,10
+	.p2align 3
+.L1003:
+	movdqu	(%rax), %xmm4
+	movq	16(%rax), %rcx
+	addq	$24, %rax
+	addq	$24, %rdx
+	movups	%xmm4, -24(%rdx)
+	movq	%rcx, -8(%rdx)
+	cmpq	%rbx, %rax
+	jne	.L1003
+	movq	32(%rsp), %rdi
+	leaq	1(%rsi), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L1004:
+	leaq	(%rdx,%rdx,2), %rax
+	leaq	(%rdi,%rax,8), %rbx
+.L998:
+	addq	$24, %rbx
+	testq	%r13, %r13
+	je	.L1005
+	movq	208(%rsp), %rsi
+	movq	%r13, %rdi
+	subq	%r13, %rsi
+	call	_ZdlPvm@PLT
+.L1005:
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rax
+	movq	%rbx, 200(%rsp)
+	addq	%rdi, %rax
+	movq	%rdi, 192(%rsp)
+	movq	%rax, 208(%rsp)
+.L988:
+	cmpq	$0, 24(%rsp)
+	je	.L1012
+.L987:
+	movq	24(%rsp), %rdi
+	movq	%r15, %rsi
+	call	_ZdlPvm@PLT
+.L1012:
+	subl	$1, 48(%rsp)
+	jne	.L1013
+	leaq	224(%rsp), %rax
+	leaq	192(%rsp), %rbx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 88(%rsp)
+.LEHB54:
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_
+.LEHE54:
+	movq	232(%rsp), %r14
+	cmpq	%r14, 240(%rsp)
+	je	.L1520
+	movq	240(%rsp), %rax
+	xorl	%ecx, %ecx
+	xorl	%esi, %esi
+	pxor	%xmm0, %xmm0
+	movq	%rcx, 16(%r14)
+	movq	%r14, %r13
+	xorl	%r12d, %r12d
+	xorl	%ebp, %ebp
+	movq	$-1, 48(%rsp)
+	xorl	%r15d, %r15d
+	movq	%rsi, 40(%rsp)
+	movq	%rax, 24(%rsp)
+	movups	%xmm0, (%r14)
+.L1023:
+	xorl	%r10d, %r10d
+	xorl	%ecx, %ecx
+	movq	%r10, 0(%r13)
+	movq	%r10, 16(%r13)
+.L1025:
+	movq	%rcx, 8(%r13)
+	addq	$24, %r13
+	movq	%r13, 232(%rsp)
+.L1026:
+	movq	232(%rsp), %r14
+	movq	24(%rsp), %rax
+	cmpq	%rax, %r14
+	je	.L1045
+	movq	40(%rsp), %r13
+	pxor	%xmm0, %xmm0
+	xorl	%esi, %esi
+	movq	%rsi, 16(%r14)
+	movups	%xmm0, (%r14)
+	subq	%r15, %r13
+	je	.L1046
+	js	.L1521
+	movq	%r13, %rdi
+.LEHB55:
+	call	_Znwm@PLT
+.LEHE55:
+	leaq	(%rax,%r13), %rcx
+	movq	%rax, %xmm0
+	movq	%rax, %rdi
+	movq	%r13, %rdx
+	movq	%rcx, 16(%r14)
+	punpcklqdq	%xmm0, %xmm0
+	movq	%r15, %rsi
+	movups	%xmm0, (%r14)
+	movq	%rcx, (%rsp)
+	call	memcpy@PLT
+	movq	(%rsp), %rcx
+	leaq	24(%r14), %rax
+	movq	%rax, 232(%rsp)
+	movq	%rcx, 8(%r14)
+.L1048:
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.L1067:
+	testq	%rbp, %rbp
+	je	.L1068
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	_ZdlPvm@PLT
+.L1068:
+	addq	$1, %r12
+	cmpq	$129, %r12
+	je	.L1069
+	movq	%r12, %rdi
+.LEHB56:
+	call	_Znwm@PLT
+.LEHE56:
+	addq	$1, 48(%rsp)
+	movq	%rax, %rbp
+	leaq	1(%rax), %r13
+	movb	$0, (%rax)
+	je	.L1499
+	movq	48(%rsp), %r14
+	leaq	0(%rbp,%r12), %rax
+	movq	%r13, %rdi
+	xorl	%esi, %esi
+	movq	%rax, 32(%rsp)
+	movq	%r14, %rdx
+	call	memset@PLT
+	movq	%r12, %rdi
+.LEHB57:
+	call	_Znwm@PLT
+.LEHE57:
+	movb	$0, (%rax)
+	movq	%rax, %r15
+	xorl	%esi, %esi
+	leaq	(%rax,%r12), %rax
+	leaq	1(%r15), %rdi
+	movq	%r14, %rdx
+	movq	%rax, 40(%rsp)
+	call	memset@PLT
+	movl	%r12d, %edi
+	movl	%r12d, %esi
+	cmpl	$14, %r14d
+	jbe	.L1280
+	movd	%r12d, %xmm0
+	movl	%r12d, %ecx
+	movdqa	.LC40(%rip), %xmm1
+	movdqa	.LC44(%rip), %xmm7
+	punpcklbw	%xmm0, %xmm0
+	movdqa	.LC45(%rip), %xmm6
+	movdqa	.LC46(%rip), %xmm5
+	shrl	$4, %ecx
+	punpcklwd	%xmm0, %xmm0
+	movdqa	.LC47(%rip), %xmm4
+	movdqa	.LC48(%rip), %xmm3
+	xorl	%eax, %eax
+	pshufd	$0, %xmm0, %xmm2
+.L1018:
+	movdqa	%xmm1, %xmm9
+	movq	%rax, %rdx
+	paddd	%xmm7, %xmm1
+	addq	$1, %rax
+	movdqa	%xmm9, %xmm10
+	movdqa	%xmm9, %xmm0
+	movdqa	%xmm9, %xmm8
+	salq	$4, %rdx
+	paddd	%xmm6, %xmm10
+	punpcklwd	%xmm10, %xmm0
+	punpckhwd	%xmm10, %xmm8
+	movdqa	%xmm0, %xmm10
+	punpcklwd	%xmm8, %xmm0
+	punpckhwd	%xmm8, %xmm10
+	movdqa	%xmm9, %xmm8
+	paddd	%xmm4, %xmm9
+	paddd	%xmm5, %xmm8
+	punpcklwd	%xmm10, %xmm0
+	movdqa	%xmm8, %xmm10
+	punpcklwd	%xmm9, %xmm8
+	pand	%xmm3, %xmm0
+	punpckhwd	%xmm9, %xmm10
+	movdqa	%xmm8, %xmm9
+	punpckhwd	%xmm10, %xmm9
+	punpcklwd	%xmm10, %xmm8
+	punpcklwd	%xmm9, %xmm8
+	movdqa	%xmm8, %xmm9
+	movdqa	%xmm0, %xmm8
+	pand	%xmm3, %xmm9
+	packuswb	%xmm9, %xmm8
+	movdqa	%xmm8, %xmm0
+	paddb	%xmm8, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm8, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm8, %xmm0
+	paddb	%xmm2, %xmm0
+	movups	%xmm0, 0(%rbp,%rdx)
+	cmpl	%ecx, %eax
+	jb	.L1018
+	movl	%esi, %edx
+	andl	$-16, %edx
+	movl	%edx, %ecx
+	testb	$15, %sil
+	je	.L1019
+.L1017:
+	movl	%esi, %eax
+	subl	%edx, %eax
+	leal	-1(%rax), %r8d
+	movl	%eax, %r10d
+	cmpl	$6, %r8d
+	jbe	.L1020
+	leal	1(%rcx), %r8d
+	movd	%ecx, %xmm2
+	movq	.LC49(%rip), %xmm0
+	movd	%r8d, %xmm7
+	movzbl	%dil, %r8d
+	punpckldq	%xmm7, %xmm2
+	movl	%r8d, %eax
+	paddd	%xmm2, %xmm0
+	movdqa	%xmm2, %xmm3
+	movdqa	%xmm2, %xmm1
+	movb	%al, %ah
+	movl	%eax, %r8d
+	movl	%r10d, %eax
+	movd	%r8d, %xmm6
+	andl	$-8, %eax
+	punpcklwd	%xmm0, %xmm3
+	punpcklwd	%xmm0, %xmm1
+	addl	%eax, %ecx
+	andb	$7, %r10b
+	movq	.LC50(%rip), %xmm0
+	pshufd	$78, %xmm3, %xmm3
+	punpcklwd	%xmm3, %xmm1
+	movq	.LC51(%rip), %xmm3
+	paddd	%xmm2, %xmm0
+	paddd	%xmm3, %xmm2
+	movdqa	%xmm0, %xmm3
+	punpcklwd	%xmm2, %xmm3
+	punpcklwd	%xmm2, %xmm0
+	movq	.LC52(%rip), %xmm2
+	pshufd	$78, %xmm3, %xmm3
+	punpcklwd	%xmm3, %xmm0
+	pand	%xmm2, %xmm1
+	pand	%xmm0, %xmm2
+	packuswb	%xmm2, %xmm1
+	pshuflw	$0, %xmm6, %xmm2
+	pshufd	$8, %xmm1, %xmm1
+	movdqa	%xmm1, %xmm0
+	paddb	%xmm1, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm1, %xmm0
+	paddb	%xmm2, %xmm1
+	paddb	%xmm0, %xmm0
+	paddb	%xmm0, %xmm0
+	paddb	%xmm1, %xmm0
+	movq	%xmm0, 0(%rbp,%rdx)
+	je	.L1021
+.L1020:
+	movl	$37, %edx
+	movl	%ecx, %eax
+	movslq	%ecx, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	1(%rcx), %eax
+	cmpl	%r12d, %eax
+	jge	.L1021
+	movslq	%eax, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	2(%rcx), %eax
+	cmpl	%eax, %r12d
+	jle	.L1021
+	movslq	%eax, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	3(%rcx), %eax
+	cmpl	%eax, %r12d
+	jle	.L1021
+	movslq	%eax, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	4(%rcx), %eax
+	cmpl	%r12d, %eax
+	jge	.L1021
+	movslq	%eax, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	5(%rcx), %eax
+	cmpl	%eax, %r12d
+	jle	.L1021
+	movslq	%eax, %r9
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%r9)
+	leal	6(%rcx), %eax
+	cmpl	%eax, %r12d
+	jle	.L1021
+	movslq	%eax, %rcx
+	imull	%edx, %eax
+	addl	%edi, %eax
+	movb	%al, 0(%rbp,%rcx)
+.L1021:
+	movl	%esi, %edx
+.L1019:
+	movq	%r15, %rcx
+	leal	0(,%rdx,8), %r8d
+	movl	$2216757315, %esi
+	leaq	_ZL8alphanum(%rip), %rdi
+	.p2align 4,,10
+	.p2align 3
+.L1022:
+	movl	%edx, %eax
+	movl	%edx, %r9d
+	addl	$7, %edx
+	addq	$1, %rcx
+	shrl	%eax
+	imulq	%rsi, %rax
+	shrq	$36, %rax
+	imull	$62, %eax, %eax
+	subl	%eax, %r9d
+	movslq	%r9d, %rax
+	movzbl	(%rdi,%rax), %eax
+	movb	%al, -1(%rcx)
+	cmpl	%edx, %r8d
+	jne	.L1022
+	movq	240(%rsp), %rax
+	movq	232(%rsp), %r13
+	movq	%rax, 24(%rsp)
+	movq	%rax, %r14
+	cmpq	%rax, %r13
+	je	.L1015
+	movq	32(%rsp), %r14
+	pxor	%xmm0, %xmm0
+	xorl	%r11d, %r11d
+	movq	%r11, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	subq	%rbp, %r14
+	je	.L1023
+	js	.L1522
+	movq	%r14, %rdi
+.LEHB58:
+	call	_Znwm@PLT
+.LEHE58:
+	leaq	(%rax,%r14), %rcx
+	movq	%rax, %xmm0
+	movq	%rax, %rdi
+	movq	%r14, %rdx
+	movq	%rcx, 16(%r13)
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rbp, %rsi
+	movups	%xmm0, 0(%r13)
+	movq	%rcx, (%rsp)
+	call	memcpy@PLT
+	movq	240(%rsp), %rax
+	movq	(%rsp), %rcx
+	movq	%rax, 24(%rsp)
+	jmp	.L1025
+	.p2align 4,,10
+	.p2align 3
+.L1515:
+	movq	%r15, %rdi
+	leaq	192(%rsp), %rbx
+.LEHB59:
+	call	_Znwm@PLT
+.LEHE59:
+	movq	%rax, %rbp
+	leaq	(%rax,%r15), %rax
+	xorl	%r12d, %r12d
+	movq	%rax, (%rsp)
+	leaq	_ZL8alphanum(%rip), %r15
+	movq	%rbp, 24(%rsp)
+	jmp	.L981
+	.p2align 4,,10
+	.p2align 3
+.L1524:
+	movzbl	(%r15,%rbx), %eax
+	addl	$1, %r12d
+	addq	$1, %rbp
+	movb	%al, -1(%rbp)
+	cmpl	%r12d, %r13d
+	jle	.L1523
+.L981:
+	movl	$61, %edx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
+	movslq	%eax, %rbx
+	movq	(%rsp), %rax
+	cmpq	%rax, %rbp
+	jne	.L1524
+	movq	24(%rsp), %rdi
+	subq	%rdi, %rax
+	movabsq	$9223372036854775807, %rdi
+	movq	%rax, %rbp
+	cmpq	%rdi, %rax
+	je	.L1525
+	movq	$1, 32(%rsp)
+	testq	%rax, %rax
+	je	.L977
+	movabsq	$9223372036854775807, %rdi
+	leaq	(%rax,%rax), %rdx
+	movabsq	$9223372036854775807, %rax
+	cmpq	%rax, %rdx
+	cmovbe	%rdx, %rax
+	cmpq	%rbp, %rdx
+	cmovb	%rdi, %rax
+	movq	%rax, 32(%rsp)
+.L977:
+	movq	32(%rsp), %rdi
+.LEHB60:
+	call	_Znwm@PLT
 	movq	%rax, %rcx
-	jmp	.L38
+	movzbl	(%r15,%rbx), %eax
+	movq	%rbp, %rdx
+	movb	%al, (%rcx,%rbp)
+	leaq	1(%rcx,%rbp), %rbp
+	testq	%rdx, %rdx
+	jg	.L1526
+	cmpq	$0, 24(%rsp)
+	jne	.L979
+.L980:
+	movq	32(%rsp), %rax
+	addl	$1, %r12d
+	movq	%rcx, 24(%rsp)
+	addq	%rcx, %rax
+	movq	%rax, (%rsp)
+	cmpl	%r12d, %r13d
+	jg	.L981
 	.p2align 4,,10
 	.p2align 3
-.L55:
-	movabsq	$9223372036854775800, %rax
-	movq	%rax, 8(%rsp)
+.L1523:
+	movq	(%rsp), %r15
+	movq	24(%rsp), %rax
+	movq	200(%rsp), %r12
+	movq	208(%rsp), %rbx
+	subq	%rax, %r15
+	cmpq	%rbx, %r12
+	je	.L984
+	movq	$0, 16(%r12)
+	pxor	%xmm0, %xmm0
+	movups	%xmm0, (%r12)
+	subq	%rax, %rbp
+	je	.L985
+	js	.L1527
+	movq	%rbp, %rdi
+	call	_Znwm@PLT
+	leaq	(%rax,%rbp), %rbx
+	movq	%rax, %xmm0
 	movq	%rax, %rdi
-.L34:
-.LEHB3:
-	call	_Znwm
-.LEHE3:
-	movq	%rax, %r12
-	jmp	.L54
+	movq	%rbp, %rdx
+	movq	%rbx, 16(%r12)
+	punpcklqdq	%xmm0, %xmm0
+	movq	24(%rsp), %rsi
+	movups	%xmm0, (%r12)
+	call	memcpy@PLT
+	movq	200(%rsp), %rax
+	movq	%rbx, 8(%r12)
+	addq	$24, %rax
+	movq	%rax, 200(%rsp)
+	jmp	.L987
 	.p2align 4,,10
 	.p2align 3
-.L36:
-	movq	$0, 16(%r15)
-	xorl	%edx, %edx
+.L1526:
+	movq	24(%rsp), %rsi
+	movq	%rcx, %rdi
+	call	memmove@PLT
+	movq	%rax, %rcx
+.L979:
+	movq	(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	movq	%rcx, 40(%rsp)
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+	movq	40(%rsp), %rcx
+	jmp	.L980
+	.p2align 4,,10
+	.p2align 3
+.L983:
+	movq	$0, (%rbx)
+	addq	$24, %rbx
+	movq	$0, -16(%rbx)
+	movq	$0, -8(%rbx)
+	movq	%rbx, 200(%rsp)
+	jmp	.L1012
+.L995:
+	xorl	%eax, %eax
 	xorl	%ecx, %ecx
-	jmp	.L38
+	movq	%rax, (%r12)
+	movq	%rax, 16(%r12)
+	jmp	.L997
+.L1275:
+	movabsq	$384307168202282325, %rax
+.L993:
+	leaq	(%rax,%rax,2), %rax
+	salq	$3, %rax
+	movq	%rax, %rdi
+	movq	%rax, 40(%rsp)
+	call	_Znwm@PLT
+	movq	%rax, 32(%rsp)
+	jmp	.L994
+.L1519:
+	leaq	1(%rsi), %rdx
+	movq	%r11, %rax
+	movq	%rdx, %rsi
+	shrq	%rsi
+	imulq	$48, %rsi, %rsi
+	addq	%r11, %rsi
 	.p2align 4,,10
 	.p2align 3
-.L58:
+.L1000:
+	movdqu	(%rcx), %xmm5
+	movdqu	16(%rcx), %xmm6
+	addq	$48, %rax
+	addq	$48, %rcx
+	movdqu	-16(%rcx), %xmm7
+	movups	%xmm5, -48(%rax)
+	movups	%xmm6, -32(%rax)
+	movups	%xmm7, -16(%rax)
+	cmpq	%rsi, %rax
+	jne	.L1000
+	movq	%rdx, %rax
+	movq	32(%rsp), %rdi
+	andq	$-2, %rax
+	imulq	$24, %rax, %rax
+	leaq	(%rdi,%rax), %rcx
+	addq	%r13, %rax
+	testb	$1, %dl
+	je	.L1004
+	movdqu	(%rax), %xmm3
+	movq	16(%rax), %rax
+	movups	%xmm3, (%rcx)
+	movq	%rax, 16(%rcx)
+	jmp	.L1004
+.L1278:
+	movq	32(%rsp), %rdx
+	movq	%r13, %rax
+	jmp	.L1003
+.L1513:
+	leaq	1(%rax), %rcx
+	movq	%rbx, %rax
+	movq	%rcx, %rsi
+	shrq	%rsi
+	imulq	$48, %rsi, %rsi
+	addq	%rbx, %rsi
+.L966:
+	movdqu	(%rdx), %xmm1
+	movdqu	16(%rdx), %xmm2
+	addq	$48, %rax
+	addq	$48, %rdx
+	movups	%xmm1, -48(%rax)
+	movdqu	-16(%rdx), %xmm1
+	movups	%xmm2, -32(%rax)
+	movups	%xmm1, -16(%rax)
+	cmpq	%rsi, %rax
+	jne	.L966
+	movq	%rcx, %rax
+	andq	$-2, %rax
+	imulq	$24, %rax, %rax
+	leaq	(%rbx,%rax), %rdx
+	addq	%rdi, %rax
+	andb	$1, %cl
+	je	.L968
+	movdqu	(%rax), %xmm2
+	movq	16(%rax), %rax
+	movups	%xmm2, (%rdx)
+	movq	%rax, 16(%rdx)
+	jmp	.L968
+.L1527:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE60:
+.L1277:
+	movq	32(%rsp), %rbx
+	jmp	.L998
+.L1046:
+	xorl	%ecx, %ecx
+	leaq	24(%r14), %rax
+	movq	%rcx, 16(%r14)
+	movq	%rax, 232(%rsp)
+.L1049:
+	testq	%r15, %r15
+	je	.L1067
+	jmp	.L1048
+.L1518:
+.LEHB61:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE61:
+.L1499:
+	movq	%r12, %rdi
+.LEHB62:
+	call	_Znwm@PLT
+.LEHE62:
+	movb	$0, (%rax)
+	movq	%rax, %r15
+	leaq	1(%rax), %rax
+	movl	%r12d, %edi
+	movq	%rax, 40(%rsp)
+	movl	%r12d, %esi
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	movq	%r13, 32(%rsp)
+	jmp	.L1017
+.L1520:
+	xorl	%r13d, %r13d
+	xorl	%eax, %eax
+	xorl	%r12d, %r12d
+	xorl	%ebp, %ebp
+	movq	$-1, 48(%rsp)
+	xorl	%r15d, %r15d
+	movq	%r13, 40(%rsp)
+	movq	%rax, 32(%rsp)
+.L1015:
+	movq	224(%rsp), %rdi
+	movq	%r14, %rax
+	movabsq	$-6148914691236517205, %rdx
+	movabsq	$384307168202282325, %rcx
+	subq	%rdi, %rax
+	movq	%rdi, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	sarq	$3, %rax
+	imulq	%rdx, %rax
+	cmpq	%rcx, %rax
+	je	.L1528
+	cmpq	%r14, 64(%rsp)
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	movq	%rax, 24(%rsp)
+	jc	.L1282
+	xorl	%r9d, %r9d
+	movq	%r9, (%rsp)
+	testq	%rax, %rax
+	jne	.L1529
+.L1032:
+	xorl	%r8d, %r8d
+	subq	%rbp, 32(%rsp)
+	movq	(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	movq	72(%rsp), %rsi
+	leaq	(%rax,%rsi), %r13
+	movq	%r8, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	je	.L1033
+	js	.L1530
+	movq	32(%rsp), %rdi
+.LEHB63:
+	call	_Znwm@PLT
+.LEHE63:
+	movq	32(%rsp), %rdx
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	movq	%rbp, %rsi
+	leaq	(%rax,%rdx), %rcx
+	movq	%rcx, 16(%r13)
+	movq	%rcx, 32(%rsp)
+	call	memcpy@PLT
+	movq	32(%rsp), %rcx
+.L1035:
+	movq	(%rsp), %rdx
+	movq	64(%rsp), %rax
+	movq	%rcx, 8(%r13)
+	jmp	.L1036
+.L1037:
+	movq	16(%rax), %rcx
+	movdqu	(%rax), %xmm5
+	addq	$24, %rax
+	movq	%rcx, -8(%rdx)
+	movups	%xmm5, -24(%rdx)
+.L1036:
+	addq	$24, %rdx
+	cmpq	%r14, %rax
+	jne	.L1037
+	movq	64(%rsp), %rdi
+	movq	(%rsp), %rsi
+	movabsq	$768614336404564651, %rdx
+	subq	%rdi, %rax
+	shrq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$2305843009213693951, %rdx
+	andq	%rdx, %rax
+	addq	$1, %rax
+	imulq	$24, %rax, %rax
+	leaq	(%rsi,%rax), %r13
+	testq	%rdi, %rdi
+	je	.L1038
+	movq	72(%rsp), %rsi
+	call	_ZdlPvm@PLT
+.L1038:
+	imulq	$24, 24(%rsp), %rax
+	movq	(%rsp), %rsi
+	movq	%r13, 232(%rsp)
+	movq	%rsi, 224(%rsp)
+	addq	%rsi, %rax
+	movq	%rax, 240(%rsp)
+	movq	%rax, 24(%rsp)
+	jmp	.L1026
+.L1045:
+	movq	224(%rsp), %rax
+	movq	24(%rsp), %r13
+	movabsq	$-6148914691236517205, %rdx
+	movabsq	$384307168202282325, %rcx
+	subq	%rax, %r13
+	movq	%rax, 64(%rsp)
 	movq	%r13, %rax
+	sarq	$3, %rax
+	imulq	%rdx, %rax
+	cmpq	%rcx, %rax
+	je	.L1531
+	movq	64(%rsp), %rsi
+	movl	$1, %edx
+	cmpq	%rsi, 24(%rsp)
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	movq	%rax, 32(%rsp)
+	jc	.L1285
+	xorl	%edx, %edx
+	movq	%rdx, (%rsp)
+	testq	%rax, %rax
+	jne	.L1532
+.L1055:
+	movq	(%rsp), %rax
+	pxor	%xmm0, %xmm0
+	addq	%rax, %r13
+	xorl	%eax, %eax
+	subq	%r15, 40(%rsp)
+	movq	%rax, 16(%r13)
+	movups	%xmm0, 0(%r13)
+	je	.L1056
+	js	.L1533
+	movq	40(%rsp), %rdi
+.LEHB64:
+	call	_Znwm@PLT
+.LEHE64:
+	movq	40(%rsp), %rdx
+	movq	%rax, 0(%r13)
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	leaq	(%rax,%rdx), %rcx
+	movq	%rcx, 16(%r13)
+	movq	%rcx, 40(%rsp)
+	call	memcpy@PLT
+	movq	40(%rsp), %rcx
+.L1058:
+	movq	(%rsp), %rdx
+	movq	64(%rsp), %rax
+	movq	%rcx, 8(%r13)
+	jmp	.L1059
+.L1060:
+	movq	16(%rax), %rcx
+	movdqu	(%rax), %xmm6
+	addq	$24, %rax
+	movq	%rcx, -8(%rdx)
+	movups	%xmm6, -24(%rdx)
+.L1059:
+	addq	$24, %rdx
+	cmpq	%rax, %r14
+	jne	.L1060
+	movq	64(%rsp), %rdi
+	movq	%r14, %rax
+	movq	(%rsp), %rsi
+	movabsq	$768614336404564651, %rdx
+	subq	%rdi, %rax
+	shrq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$2305843009213693951, %rdx
+	andq	%rdx, %rax
+	addq	$1, %rax
+	imulq	$24, %rax, %rax
+	leaq	(%rsi,%rax), %r13
+	testq	%rdi, %rdi
+	je	.L1061
+	movq	24(%rsp), %rsi
+	subq	%rdi, %rsi
+	call	_ZdlPvm@PLT
+.L1061:
+	imulq	$24, 32(%rsp), %rax
+	movq	(%rsp), %rdi
+	movq	%r13, 232(%rsp)
+	movq	%rdi, 224(%rsp)
+	addq	%rdi, %rax
+	movq	%rax, 240(%rsp)
+	jmp	.L1049
+.L1285:
+	movq	%rcx, 32(%rsp)
+.L1054:
+	imulq	$24, 32(%rsp), %rdi
+.LEHB65:
+	call	_Znwm@PLT
+	movq	%rax, (%rsp)
+	jmp	.L1055
+.L1282:
+	movq	%rcx, 24(%rsp)
+.L1031:
+	imulq	$24, 24(%rsp), %rdi
+	call	_Znwm@PLT
+.LEHE65:
+	movq	%rax, (%rsp)
+	jmp	.L1032
+.L1033:
+	xorl	%edi, %edi
+	xorl	%ecx, %ecx
+	movq	%rdi, 0(%r13)
+	movq	%rdi, 16(%r13)
+	jmp	.L1035
+.L1056:
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	movq	%rax, 0(%r13)
+	movq	%rax, 16(%r13)
+	jmp	.L1058
+.L1517:
+	movabsq	$384307168202282325, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+	jmp	.L993
+.L1522:
+.LEHB66:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE66:
+.L1521:
+.LEHB67:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L1532:
+	movabsq	$384307168202282325, %rax
+	movq	32(%rsp), %rdi
+	cmpq	%rax, %rdi
+	cmovbe	%rdi, %rax
+	movq	%rax, 32(%rsp)
+	jmp	.L1054
+.L1528:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE67:
+.L1530:
+.LEHB68:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE68:
+.L1531:
+	leaq	.LC34(%rip), %rdi
+.LEHB69:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE69:
+.L1529:
+	movabsq	$384307168202282325, %rax
+	movq	24(%rsp), %rdi
+	cmpq	%rax, %rdi
+	cmovbe	%rdi, %rax
+	movq	%rax, 24(%rsp)
+	jmp	.L1031
+.L1280:
+	xorl	%edx, %edx
+	xorl	%ecx, %ecx
+	jmp	.L1017
+.L1069:
+	leaq	432(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 40(%rsp)
+.LEHB70:
+	call	_Z17supported_kernelsv
+.LEHE70:
+	movq	440(%rsp), %rax
+	movq	432(%rsp), %r14
+	movq	%rax, 96(%rsp)
+.L1071:
+	cmpq	%r14, 96(%rsp)
+	je	.L1534
+	movq	232(%rsp), %rax
+	movq	224(%rsp), %rbp
+	movl	$1, %r13d
+	movq	%rax, 112(%rsp)
+	leaq	560(%rsp), %rax
+	movq	%rax, 120(%rsp)
+.L1072:
+	cmpq	%rbp, 112(%rsp)
+	je	.L1535
+	movq	32(%r14), %rdx
+	movq	8(%rbp), %rax
+	leaq	_Z18shift_range_scalarILc97ELc122ELc32EEvPci(%rip), %rdi
+	subq	0(%rbp), %rax
+	movq	%rdi, 536(%rsp)
+	leaq	_Z18shift_range_scalarILc65ELc90ELcn32EEvPci(%rip), %rdi
+	movl	%eax, %esi
+	movq	%rdx, 528(%rsp)
+	movq	40(%r14), %rdx
+	andl	$1, %eax
+	movq	%rdi, 552(%rsp)
+	andl	$-2, %esi
+	leaq	528(%rsp), %rdi
+	movl	%esi, 32(%rsp)
+	movq	%rdx, 544(%rsp)
+	movq	%rdi, (%rsp)
+	movq	%rax, 72(%rsp)
+.L1084:
+	movq	8(%rbp), %rax
+	subq	0(%rbp), %rax
+	movq	%rax, 48(%rsp)
+	je	.L1287
+	js	.L1536
+	movq	48(%rsp), %rdi
+.LEHB71:
+	call	_Znwm@PLT
+.LEHE71:
+	movq	%rax, %r15
+.L1073:
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rax
+	subq	%rsi, %rax
+	movq	%rax, 64(%rsp)
+	jne	.L1537
+	xorl	%r10d, %r10d
+	xorl	%r11d, %r11d
+	xorl	%r12d, %r12d
+	movq	%r10, 80(%rsp)
+	movq	%r11, 24(%rsp)
+.L1075:
+	movq	72(%rsp), %rax
+	movq	(%rsp), %rcx
+	movl	32(%rsp), %esi
+	leaq	(%r15,%rax), %rdi
+.LEHB72:
+	call	*(%rcx)
+	movq	72(%rsp), %rax
+	movq	(%rsp), %rcx
+	movl	32(%rsp), %esi
+	leaq	(%r12,%rax), %rdi
+	call	*8(%rcx)
+.LEHE72:
+	movq	64(%rsp), %rsi
+	cmpq	%rsi, 80(%rsp)
+	sete	%al
+	andb	%al, %r13b
+	jne	.L1538
+.L1080:
+	testq	%r12, %r12
+	je	.L1082
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	call	_ZdlPvm@PLT
+.L1082:
+	testq	%r15, %r15
+	je	.L1083
+.L1081:
+	movq	48(%rsp), %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.L1083:
+	addq	$16, (%rsp)
+	movq	120(%rsp), %rdi
+	movq	(%rsp), %rax
+	cmpq	%rdi, %rax
+	jne	.L1084
+	testb	%r13b, %r13b
+	jne	.L1539
+.L1085:
+	addq	$24, %rbp
+	jmp	.L1072
+.L1537:
+	movq	%rax, %rdx
+	movq	%r15, %rdi
+	call	memmove@PLT
+	movq	8(%rbp), %rax
+	subq	0(%rbp), %rax
+	movq	%rax, 24(%rsp)
+	je	.L1289
+	js	.L1540
+	movq	24(%rsp), %rdi
+.LEHB73:
+	call	_Znwm@PLT
+.LEHE73:
+	movq	%rax, %r12
+.L1076:
+	movq	0(%rbp), %rsi
+	movq	8(%rbp), %rdx
+	subq	%rsi, %rdx
+	movq	%rdx, 80(%rsp)
+	je	.L1075
+	movq	%r12, %rdi
+	call	memmove@PLT
+	jmp	.L1075
+.L1287:
+	xorl	%r15d, %r15d
+	jmp	.L1073
+.L1538:
+	movq	%rsi, %rdx
+	testq	%rsi, %rsi
+	je	.L1080
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	memcmp@PLT
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	testl	%eax, %eax
+	sete	%r13b
+	call	_ZdlPvm@PLT
+	jmp	.L1081
+.L1539:
+	movq	72(%rsp), %r15
+	movq	0(%rbp), %rdi
+	movl	32(%rsp), %esi
+	addq	%r15, %rdi
+.LEHB74:
+	call	*48(%r14)
+	movl	%eax, %esi
+	movq	0(%rbp), %rax
+	xorl	%edx, %edx
+	addq	%r15, %rax
+.L1086:
+	cmpl	%edx, 32(%rsp)
+	jle	.L1087
+	movzbl	(%rax,%rdx), %ecx
+	addq	$1, %rdx
+	movl	%ecx, %edi
+	orl	$32, %edi
+	subl	$97, %edi
+	cmpb	$25, %dil
+	jbe	.L1086
+	subl	$48, %ecx
+	cmpb	$9, %cl
+	jbe	.L1086
+	xorl	%r13d, %r13d
+.L1087:
+	cmpb	%r13b, %sil
+	sete	%r13b
+	jmp	.L1085
+.L1536:
+	call	_ZSt17__throw_bad_allocv@PLT
+.L1535:
+	movq	8(%r14), %rdx
+	movq	(%r14), %rsi
+	leaq	_ZSt4cout(%rip), %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$15, %edx
+	leaq	.LC53(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	testb	%r13b, %r13b
+	leaq	.LC41(%rip), %rsi
+	movl	$6, %edx
+	movq	%rbp, %rdi
+	leaq	.LC42(%rip), %rax
+	cmove	%rax, %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	0(%rbp), %rax
+	movq	-24(%rax), %rax
+	movq	240(%rbp,%rax), %r12
+	testq	%r12, %r12
+	je	.L1541
+	cmpb	$0, 56(%r12)
+	je	.L1093
+	movzbl	67(%r12), %eax
+.L1094:
+	movsbl	%al, %esi
+	movq	%rbp, %rdi
+	call	_ZNSo3putEc@PLT
+	movq	%rax, %rdi
+	call	_ZNSo5flushEv@PLT
+.LEHE74:
+	addq	$56, %r14
+	jmp	.L1071
+.L1540:
+.LEHB75:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE75:
+.L1289:
+	xorl	%r12d, %r12d
+	jmp	.L1076
+.L1093:
+	movq	%r12, %rdi
+.LEHB76:
+	call	_ZNKSt5ctypeIcE13_M_widen_initEv@PLT
+	movq	(%r12), %rax
+	leaq	_ZNKSt5ctypeIcE8do_widenEc(%rip), %rcx
+	movq	48(%rax), %rdx
+	movl	$10, %eax
+	cmpq	%rcx, %rdx
+	je	.L1094
+	movl	$10, %esi
+	movq	%r12, %rdi
+	call	*%rdx
+	jmp	.L1094
+.L1541:
+	call	_ZSt16__throw_bad_castv@PLT
+.LEHE76:
+.L1534:
+	movq	40(%rsp), %rdi
+	leaq	_ZSt4cout(%rip), %rbp
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev
+	movl	$18, %edx
+	leaq	.LC54(%rip), %rsi
+	movq	%rbp, %rdi
+.LEHB77:
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	8+_ZL5ascii(%rip), %rdx
+	movq	_ZL5ascii(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	%rax, %rdi
+	call	_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0
+	xorl	%r9d, %r9d
+	movq	200(%rsp), %rcx
+	movq	192(%rsp), %rax
+	movq	%r9, (%rsp)
+	jmp	.L1096
+.L1097:
+	movq	8(%rax), %rdx
+	subq	(%rax), %rdx
+	addq	$24, %rax
+	addq	%rdx, (%rsp)
+.L1096:
+	cmpq	%rax, %rcx
+	jne	.L1097
+	leaq	384(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 32(%rsp)
+	call	_ZN10StringPoolC1Ev
+.LEHE77:
+	movq	200(%rsp), %rax
+	subq	192(%rsp), %rax
+	movabsq	$-6148914691236517205, %rdx
+	sarq	$3, %rax
+	imulq	%rdx, %rax
+	movabsq	$1152921504606846975, %rdx
+	addq	$1, %rax
+	cmpq	%rax, %rdx
+	jb	.L1542
+	movq	408(%rsp), %rcx
+	movq	424(%rsp), %rdx
+	subq	%rcx, %rdx
+	sarq	$3, %rdx
+	cmpq	%rax, %rdx
+	jb	.L1543
+.L1099:
+	cmpq	$0, (%rsp)
+	js	.L1544
+	movq	384(%rsp), %rdx
+	movq	400(%rsp), %rax
+	movq	(%rsp), %rsi
+	subq	%rdx, %rax
+	cmpq	%rsi, %rax
+	jb	.L1545
+.L1104:
+	movq	200(%rsp), %rax
+	movq	%rax, 112(%rsp)
+	movq	192(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	jmp	.L1108
+.L1547:
+	movq	%r12, %rdx
+	movq	%r14, %rdi
+	call	memmove@PLT
+	addq	%r12, 392(%rsp)
+.L1109:
+	movq	392(%rsp), %rax
+	subq	384(%rsp), %rax
+	movq	416(%rsp), %rdx
+	movq	%rax, %r15
+	cmpq	424(%rsp), %rdx
+	je	.L1123
+	movq	%rax, (%rdx)
+	addq	$8, %rdx
+	movq	%rdx, 416(%rsp)
+.L1124:
+	addq	$24, 64(%rsp)
+.L1108:
+	movq	64(%rsp), %rdi
+	cmpq	%rdi, 112(%rsp)
+	je	.L1546
+	movq	64(%rsp), %rax
+	movq	392(%rsp), %r14
+	movq	(%rax), %rsi
+	movq	8(%rax), %r12
+	movq	%rsi, 48(%rsp)
+	cmpq	%rsi, %r12
+	je	.L1109
+	movq	400(%rsp), %rdx
+	subq	%rsi, %r12
+	movq	%rdx, %rax
+	subq	%r14, %rax
+	cmpq	%r12, %rax
+	jnb	.L1547
+	movabsq	$9223372036854775807, %rcx
+	movq	%r14, %rax
+	subq	384(%rsp), %rax
+	subq	%rax, %rcx
+	cmpq	%r12, %rcx
+	jb	.L1548
+	cmpq	%rax, %r12
+	movq	%rax, %rcx
+	cmovnb	%r12, %rcx
+	addq	%rcx, %rax
+	movq	%rax, %r15
+	jc	.L1293
+	testq	%rax, %rax
+	jne	.L1549
+	movq	384(%rsp), %r13
+	movq	%r14, %r10
+	movq	%rdx, 80(%rsp)
+	movl	$0, %ecx
+	subq	%r13, %r10
+	leaq	(%r10,%r12), %r9
+	movq	%r10, %r8
+	movq	%r9, 72(%rsp)
+	jne	.L1269
+	xorl	%eax, %eax
+	movq	%rax, 24(%rsp)
+.L1116:
+	movq	48(%rsp), %rsi
 	movq	%r12, %rdx
-	.p2align 4,,10
-	.p2align 3
-.L40:
-	movdqu	(%rax), %xmm6
-	movq	16(%rax), %rsi
-	addq	$24, %rax
-	addq	$24, %rdx
-	movups	%xmm6, -24(%rdx)
-	movq	%rsi, -8(%rdx)
-	cmpq	%rax, %rbp
-	jne	.L40
-	addq	$1, %rcx
-	jmp	.L43
-	.p2align 4,,10
-	.p2align 3
-.L57:
+	movq	%r8, %rdi
+	movq	%r9, 120(%rsp)
+	movq	%rcx, 96(%rsp)
+	call	memmove@PLT
+	movq	96(%rsp), %rcx
+	movq	120(%rsp), %r9
+	testq	%rcx, %rcx
+	jne	.L1121
+.L1120:
+	testq	%r13, %r13
+	jne	.L1122
+.L1118:
+	movq	24(%rsp), %rax
+	movq	72(%rsp), %rdi
+	movq	%rax, 384(%rsp)
+	addq	%r15, %rax
+	movq	%rdi, 392(%rsp)
+	movq	%rax, 400(%rsp)
+	jmp	.L1109
+.L1533:
+.LEHB78:
+	call	_ZSt17__throw_bad_allocv@PLT
+.LEHE78:
+.L985:
+	xorl	%eax, %eax
+	addq	$24, %r12
+	movq	%rax, -24(%r12)
+	movq	%rax, -8(%r12)
+	movq	%rax, -16(%r12)
+	movq	%r12, 200(%rsp)
+	jmp	.L988
+.L1514:
+	leaq	.LC43(%rip), %rdi
+	leaq	192(%rsp), %rbx
+.LEHB79:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE79:
+.L1516:
+	leaq	.LC34(%rip), %rdi
+.LEHB80:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L1525:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE80:
+.L1546:
+	leaq	256(%rsp), %rax
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	movq	%rax, 64(%rsp)
+.LEHB81:
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EEC1ERKS3_
+.LEHE81:
+	movq	384(%rsp), %r12
+	movq	392(%rsp), %rax
+	subq	%r12, %rax
+	movq	%rax, 24(%rsp)
+	js	.L1550
+	je	.L1136
+	movq	24(%rsp), %r15
+	movq	%r15, %rdi
+.LEHB82:
+	call	_Znwm@PLT
+.LEHE82:
+	movq	%rax, %r13
+	movq	%rax, 288(%rsp)
+	movq	%r15, %rdx
+	leaq	(%rax,%r15), %rax
 	movq	%r12, %rsi
-	jmp	.L39
-.L59:
-	movq	%rsi, %rax
-	jmp	.L45
-.L83:
-.LEHB4:
-	call	_ZSt17__throw_bad_allocv
-.LEHE4:
-.L35:
+	movq	%r13, %rdi
+	movq	%rax, 304(%rsp)
+	call	memmove@PLT
+.L1137:
+	leaq	528(%rsp), %r12
+	leaq	.LC56(%rip), %rsi
+	movq	%r12, %rdi
+.LEHB83:
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0
+.LEHE83:
+	leaq	_Z18toupper_branchlessPci(%rip), %rax
+	leaq	568(%rsp), %rdi
+	leaq	.LC57(%rip), %rsi
+	movq	%rax, 560(%rsp)
+.LEHB84:
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0
+.LEHE84:
+	leaq	_Z16toupper_standardPci(%rip), %rax
+	leaq	608(%rsp), %rdi
+	leaq	.LC58(%rip), %rsi
+	movq	%rax, 600(%rsp)
+.LEHB85:
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0
+.LEHE85:
+	leaq	_Z12toupper_simdPci(%rip), %rax
+	leaq	648(%rsp), %rdi
+	leaq	.LC59(%rip), %rsi
+	movq	%rax, 640(%rsp)
+.LEHB86:
+	call	_ZNSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEC1IS3_EEPKcRKS3_.isra.0
+.LEHE86:
+	leaq	_Z12tolower_simdPci(%rip), %rax
+	movq	40(%rsp), %rcx
+	movq	%r12, %rsi
+	movl	$4, %edx
+	movq	%rax, 680(%rsp)
+	leaq	320(%rsp), %rax
 	movq	%rax, %rdi
-	movabsq	$384307168202282325, %rax
+	movq	%rax, 80(%rsp)
+.LEHB87:
+	call	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EEC1ESt16initializer_listISA_ERKSB_
+.LEHE87:
+	movq	56(%rsp), %r14
+.L1151:
+	subq	$40, %r14
+	movq	(%r14), %rdi
+	leaq	16(%r14), %rax
 	cmpq	%rax, %rdi
-	cmovbe	%rdi, %rax
-	leaq	(%rax,%rax,2), %rax
-	salq	$3, %rax
-	movq	%rax, 8(%rsp)
+	je	.L1150
+	movq	16(%r14), %rax
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+.L1150:
+	cmpq	%r12, %r14
+	jne	.L1151
+	movq	_ZSt4cout(%rip), %rax
+	movl	$6, %edx
+	leaq	.LC60(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$20, 16(%rbp,%rax)
+.LEHB88:
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	_ZSt4cout(%rip), %rax
+	movl	$6, %edx
+	leaq	.LC61(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rbp,%rax)
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	_ZSt4cout(%rip), %rax
+	movl	$8, %edx
+	leaq	.LC62(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rbp,%rax)
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	_ZSt4cout(%rip), %rax
+	movl	$11, %edx
+	leaq	.LC63(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rbp,%rax)
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	_ZSt4cout(%rip), %rax
+	movl	$10, %edx
+	leaq	.LC64(%rip), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rbp,%rax)
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	%rbp, %rdi
+	call	_ZSt4endlIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_.isra.0
+.LEHE88:
+	movq	328(%rsp), %rax
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation(%rip), %rdx
+	movq	%rdx, %xmm7
+	movq	%rax, 112(%rsp)
+	movq	320(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	movq	%rax, %r15
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE0_E9_M_invokeERKSt9_Any_data(%rip), %rax
+	movq	%rax, %xmm2
+	punpcklqdq	%xmm2, %xmm7
+	movaps	%xmm7, 176(%rsp)
+.L1152:
+	cmpq	%r15, 112(%rsp)
+	je	.L1551
+	movdqa	176(%rsp), %xmm7
+	movq	32(%r15), %rax
+	movq	%rbx, 536(%rsp)
+	movq	%rax, 528(%rsp)
+	movaps	%xmm7, 544(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	cmpq	$0, 544(%rsp)
+	movq	%rax, %r14
+	je	.L1552
+	movq	%r12, %rdi
+.LEHB89:
+	call	*552(%rsp)
+.LEHE89:
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation(%rip), %rax
+	movq	%rax, %xmm7
+	movhps	.LC85(%rip), %xmm7
+	movaps	%xmm7, 96(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	pxor	%xmm5, %xmm5
+	pxor	%xmm0, %xmm0
+	subq	%r14, %rax
+	cvtsi2sdq	(%rsp), %xmm5
+	cvtsi2sdq	%rax, %xmm0
+	movq	544(%rsp), %rax
+	movsd	%xmm5, 72(%rsp)
+	divsd	%xmm0, %xmm5
+	movsd	%xmm5, 120(%rsp)
+	testq	%rax, %rax
+	je	.L1154
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+.L1154:
+	movq	64(%rsp), %rsi
+	movq	%rbx, %rdi
+.LEHB90:
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0
+.LEHE90:
+	movq	32(%r15), %rax
+	movdqa	96(%rsp), %xmm5
+	movq	%rbx, 536(%rsp)
+	movq	%rax, 528(%rsp)
+	movaps	%xmm5, 544(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	cmpq	$0, 544(%rsp)
+	movq	%rax, %r14
+	je	.L1553
+	movq	%r12, %rdi
+.LEHB91:
+	call	*552(%rsp)
+.LEHE91:
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	pxor	%xmm0, %xmm0
+	movsd	72(%rsp), %xmm6
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	544(%rsp), %rax
+	divsd	%xmm0, %xmm6
+	movsd	%xmm6, 96(%rsp)
+	testq	%rax, %rax
+	je	.L1156
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+.L1156:
+	movq	64(%rsp), %rsi
+	movq	%rbx, %rdi
+.LEHB92:
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EEaSERKS3_.isra.0
+.LEHE92:
+	movq	384(%rsp), %rdx
+	xorl	%eax, %eax
+	jmp	.L1157
+.L1158:
+	movzbl	0(%r13,%rax), %ecx
+	movb	%cl, (%rdx,%rax)
+	addq	$1, %rax
+.L1157:
+	cmpq	%rax, 24(%rsp)
+	jne	.L1158
+	movq	32(%r15), %rax
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation(%rip), %rdi
+	movq	%rdi, %xmm0
+	movq	%rax, 528(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 536(%rsp)
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE2_E9_M_invokeERKSt9_Any_data(%rip), %rax
+	movq	%rax, %xmm6
+	punpcklqdq	%xmm6, %xmm0
+	movaps	%xmm0, 544(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	cmpq	$0, 544(%rsp)
+	movq	%rax, %r14
+	je	.L1554
+	movq	%r12, %rdi
+.LEHB93:
+	call	*552(%rsp)
+.LEHE93:
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	pxor	%xmm0, %xmm0
+	movsd	72(%rsp), %xmm7
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	544(%rsp), %rax
+	divsd	%xmm0, %xmm7
+	movsd	%xmm7, 128(%rsp)
+	testq	%rax, %rax
+	je	.L1160
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+.L1160:
+	movq	384(%rsp), %rdx
+	xorl	%eax, %eax
+	jmp	.L1161
+.L1162:
+	movzbl	0(%r13,%rax), %ecx
+	movb	%cl, (%rdx,%rax)
+	addq	$1, %rax
+.L1161:
+	movq	24(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L1162
+	movq	32(%r15), %rax
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation(%rip), %rdi
+	movq	%rdi, %xmm0
+	movq	%rax, 528(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 536(%rsp)
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE3_E9_M_invokeERKSt9_Any_data(%rip), %rax
+	movq	%rax, %xmm2
+	punpcklqdq	%xmm2, %xmm0
+	movaps	%xmm0, 544(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	cmpq	$0, 544(%rsp)
+	movq	%rax, %r14
+	je	.L1555
+	movq	%r12, %rdi
+.LEHB94:
+	call	*552(%rsp)
+.LEHE94:
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	pxor	%xmm0, %xmm0
+	movsd	72(%rsp), %xmm6
+	subq	%r14, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	544(%rsp), %rax
+	divsd	%xmm0, %xmm6
+	movq	%xmm6, %r14
+	testq	%rax, %rax
+	je	.L1164
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+.L1164:
+	movq	0(%rbp), %rax
+	movq	(%r15), %rsi
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rax
+	movq	$20, 16(%rbp,%rax)
+	movq	8(%r15), %rdx
+.LEHB95:
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
 	movq	%rax, %rdi
-	jmp	.L34
-.L82:
-	movl	$.LC3, %edi
-.LEHB5:
-	call	_ZSt20__throw_length_errorPKc
-.LEHE5:
-.L60:
+	movq	(%rax), %rax
+	movsd	120(%rsp), %xmm0
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rdi,%rax)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movq	(%rax), %rax
+	movsd	96(%rsp), %xmm0
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rdi,%rax)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movsd	128(%rsp), %xmm0
+	movq	%rax, %rdi
+	movq	(%rax), %rax
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rdi,%rax)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movq	(%rax), %rax
+	movq	%r14, %xmm0
+	movq	-24(%rax), %rax
+	movq	$14, 16(%rdi,%rax)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movq	%rax, 72(%rsp)
+	movq	(%rax), %rax
+	movq	-24(%rax), %rax
+	movq	240(%rdi,%rax), %r14
+	testq	%r14, %r14
+	je	.L1556
+	cmpb	$0, 56(%r14)
+	je	.L1166
+	movzbl	67(%r14), %eax
+.L1167:
+	movq	72(%rsp), %rdi
+	movsbl	%al, %esi
+	call	_ZNSo3putEc@PLT
 	movq	%rax, %rdi
-.L49:
-	call	__cxa_begin_catch
+	call	_ZNSo5flushEv@PLT
+.LEHE95:
+	addq	$40, %r15
+	jmp	.L1152
+.L1136:
+	xorl	%edi, %edi
+	xorl	%r13d, %r13d
+	movq	%rdi, 288(%rsp)
+	movq	%rdi, 304(%rsp)
+	jmp	.L1137
+.L1123:
+	movq	408(%rsp), %r12
+	movq	%rdx, %r13
+	movabsq	$1152921504606846975, %rsi
+	subq	%r12, %r13
+	movq	%r13, %rax
+	sarq	$3, %rax
+	cmpq	%rsi, %rax
+	je	.L1557
+	cmpq	%r12, %rdx
+	movl	$1, %edx
+	cmovne	%rax, %rdx
+	addq	%rdx, %rax
+	jc	.L1295
+	xorl	%r8d, %r8d
+	xorl	%r14d, %r14d
+	movq	%r8, 24(%rsp)
+	testq	%rax, %rax
+	jne	.L1558
+.L1130:
+	movq	424(%rsp), %rax
+	movq	%r15, (%r14,%r13)
+	leaq	8(%r14,%r13), %r15
+	movq	%rax, 48(%rsp)
+	testq	%r13, %r13
+	jg	.L1559
 	testq	%r12, %r12
-	je	.L85
-	movq	8(%rsp), %rsi
-	movq	%r12, %rdi
-	call	_ZdlPvm
-.L53:
-.LEHB6:
-	call	__cxa_rethrow
-.LEHE6:
-.L85:
-	movq	(%r15), %rdi
-	movq	16(%r15), %rsi
-	subq	%rdi, %rsi
-	testq	%rdi, %rdi
-	je	.L53
-	call	_ZdlPvm
-	jmp	.L53
-.L61:
-	movq	%rax, %rbp
-.L52:
-	call	__cxa_end_catch
-	movq	%rbp, %rdi
-.LEHB7:
-	call	_Unwind_Resume
-.LEHE7:
-	.cfi_endproc
-.LFE4170:
-	.section	.gcc_except_table._ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,"aG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,comdat
-	.align 4
-.LLSDA4170:
-	.byte	0xff
-	.byte	0x3
-	.uleb128 .LLSDATT4170-.LLSDATTD4170
-.LLSDATTD4170:
-	.byte	0x1
-	.uleb128 .LLSDACSE4170-.LLSDACSB4170
-.LLSDACSB4170:
-	.uleb128 .LEHB2-.LFB4170
-	.uleb128 .LEHE2-.LEHB2
-	.uleb128 .L60-.LFB4170
-	.uleb128 0x1
-	.uleb128 .LEHB3-.LFB4170
-	.uleb128 .LEHE3-.LEHB3
-	.uleb128 0
-	.uleb128 0
-	.uleb128 .LEHB4-.LFB4170
-	.uleb128 .LEHE4-.LEHB4
-	.uleb128 .L60-.LFB4170
-	.uleb128 0x1
-	.uleb128 .LEHB5-.LFB4170
-	.uleb128 .LEHE5-.LEHB5
-	.uleb128 0
-	.uleb128 0
-	.uleb128 .LEHB6-.LFB4170
-	.uleb128 .LEHE6-.LEHB6
-	.uleb128 .L61-.LFB4170
-	.uleb128 0
-	.uleb128 .LEHB7-.LFB4170
-	.uleb128 .LEHE7-.LEHB7
-	.uleb128 0
-	.uleb128 0
-.LLSDACSE4170:
-	.byte	0x1
-	.byte	0
-	.align 4
-	.long	0
-
-.LLSDATT4170:
-	.section	.text._ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,"axG",@progbits,_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_,comdat
-	.size	_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_, .-_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_
-	.section	.text._ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv,"axG",@progbits,_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv,comdat
-	.align 2
-	.p2align 4
-	.weak	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	.type	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv, @function
-_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv:
-.LFB4379:
-	.cfi_startproc
-	movq	%rdi, %r8
-	movq	(%rdi), %rdi
-	movl	$2567483615, %r10d
-	movq	%r8, %rax
-	leaq	1816(%r8), %r9
-	movq	%r8, %rdx
-	.p2align 4,,10
-	.p2align 3
-.L88:
-	andq	$-2147483648, %rdi
-	movq	%rdi, %rcx
-	movq	8(%rdx), %rdi
-	movq	%rdi, %rsi
-	andl	$2147483647, %esi
-	orq	%rcx, %rsi
-	movq	%rsi, %rcx
-	shrq	%rcx
-	xorq	3176(%rdx), %rcx
-	andl	$1, %esi
-	je	.L87
-	xorq	%r10, %rcx
-.L87:
-	movq	%rcx, (%rdx)
-	addq	$8, %rdx
-	cmpq	%r9, %rdx
-	jne	.L88
-	movq	1816(%r8), %rsi
-	leaq	3168(%r8), %rdi
-	movl	$2567483615, %r9d
-	.p2align 4,,10
-	.p2align 3
-.L90:
-	andq	$-2147483648, %rsi
-	movq	%rsi, %rdx
-	movq	1824(%rax), %rsi
-	movq	%rsi, %rcx
-	andl	$2147483647, %ecx
-	orq	%rdx, %rcx
-	movq	%rcx, %rdx
-	shrq	%rdx
-	xorq	(%rax), %rdx
-	andl	$1, %ecx
-	je	.L89
-	xorq	%r9, %rdx
-.L89:
-	movq	%rdx, 1816(%rax)
-	addq	$8, %rax
-	cmpq	%rdi, %rax
-	jne	.L90
-	movq	4984(%r8), %rax
-	movq	(%r8), %rdx
-	andq	$-2147483648, %rax
-	andl	$2147483647, %edx
-	orq	%rdx, %rax
-	movq	%rax, %rdx
-	shrq	%rdx
-	xorq	3168(%r8), %rdx
-	testb	$1, %al
-	je	.L91
-	movl	$2567483615, %eax
-	xorq	%rax, %rdx
-.L91:
-	movq	%rdx, 4984(%r8)
-	movq	$0, 4992(%r8)
-	ret
-	.cfi_endproc
-.LFE4379:
-	.size	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv, .-_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	.text
-	.align 2
-	.p2align 4
-	.type	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0, @function
-_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0:
-.LFB4499:
-	.cfi_startproc
-	pushq	%r15
-	.cfi_def_cfa_offset 16
-	.cfi_offset 15, -16
-	movslq	%esi, %rax
-	pushq	%r14
-	.cfi_def_cfa_offset 24
-	.cfi_offset 14, -24
-	pushq	%r13
-	.cfi_def_cfa_offset 32
-	.cfi_offset 13, -32
-	movslq	%edx, %r13
-	pushq	%r12
-	.cfi_def_cfa_offset 40
-	.cfi_offset 12, -40
-	subq	%rax, %r13
-	movq	%rdi, %r12
-	pushq	%rbp
-	.cfi_def_cfa_offset 48
-	.cfi_offset 6, -48
-	movq	%rax, %rbp
-	movl	$4294967294, %eax
-	pushq	%rbx
-	.cfi_def_cfa_offset 56
-	.cfi_offset 3, -56
-	subq	$8, %rsp
-	.cfi_def_cfa_offset 64
-	cmpq	%rax, %r13
-	jbe	.L120
-	movl	$4294967295, %eax
-	cmpq	%rax, %r13
-	je	.L110
-.L118:
-	movl	$-1, %edx
-	xorl	%esi, %esi
+	jne	.L1132
+.L1133:
+	movq	24(%rsp), %rcx
+	movq	%r14, 408(%rsp)
+	movq	%r15, 416(%rsp)
+	addq	%r14, %rcx
+	movq	%rcx, 424(%rsp)
+	jmp	.L1124
+.L1545:
+	movq	392(%rsp), %r13
+	movq	%rsi, %rdi
+	subq	%rdx, %r13
+.LEHB96:
+	call	_Znwm@PLT
+	movq	384(%rsp), %r15
+	movq	392(%rsp), %rdx
+	movq	%rax, %r14
+	movq	400(%rsp), %r12
+	subq	%r15, %rdx
+	testq	%rdx, %rdx
+	jg	.L1560
+	testq	%r15, %r15
+	jne	.L1106
+.L1107:
+	movq	(%rsp), %rax
+	addq	%r14, %r13
+	movq	%r14, 384(%rsp)
+	movq	%r13, 392(%rsp)
+	addq	%rax, %r14
+	movq	%r14, 400(%rsp)
+	jmp	.L1104
+.L1544:
+	leaq	.LC43(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.L1559:
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	memmove@PLT
+.L1132:
+	movq	48(%rsp), %rsi
 	movq	%r12, %rdi
-	call	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
-	movq	%rax, %rbx
-	movq	4992(%r12), %rax
-	salq	$32, %rbx
-	cmpq	$623, %rax
-	jbe	.L111
+	subq	%r12, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1133
+.L1560:
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	call	memmove@PLT
+.L1106:
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	subq	%r15, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1107
+.L1558:
+	movabsq	$1152921504606846975, %rdx
+	cmpq	%rdx, %rax
+	cmova	%rdx, %rax
+.L1129:
+	salq	$3, %rax
+	movq	%rax, %rdi
+	movq	%rax, 24(%rsp)
+	call	_Znwm@PLT
+	movq	%rax, %r14
+	jmp	.L1130
+.L1295:
+	movabsq	$1152921504606846975, %rax
+	jmp	.L1129
+.L1557:
+	leaq	.LC34(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE96:
+.L1550:
+	leaq	.LC35(%rip), %rdi
+.LEHB97:
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE97:
+.L1553:
+.LEHB98:
+	call	_ZSt25__throw_bad_function_callv@PLT
+.LEHE98:
+.L1552:
+.LEHB99:
+	call	_ZSt25__throw_bad_function_callv@PLT
+.LEHE99:
+.L1551:
+	movq	384(%rsp), %rdx
+	xorl	%eax, %eax
+	jmp	.L1169
+.L1170:
+	movzbl	0(%r13,%rax), %ecx
+	movb	%cl, (%rdx,%rax)
+	addq	$1, %rax
+.L1169:
+	movq	24(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L1170
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E9_M_invokeERKSt9_Any_data(%rip), %rax
+	leaq	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE4_E10_M_managerERSt9_Any_dataRKS3_St18_Manager_operation(%rip), %rdx
+	movq	%rdx, %xmm1
+	movq	%rax, %xmm3
+	punpcklqdq	%xmm3, %xmm1
+	movaps	%xmm1, 128(%rsp)
+.L1171:
+	movq	48(%rsp), %rax
+	movq	384(%rsp), %rdx
+	cmpq	%rax, %r15
+	movl	$0, %eax
+	jne	.L1227
+	jmp	.L1226
+.L1172:
+	movzbl	0(%r13,%rax), %ecx
+	movb	%cl, (%rdx,%rax)
+	addq	$1, %rax
+.L1227:
+	movq	24(%rsp), %rdi
+	cmpq	%rdi, %rax
+	jne	.L1172
+	movq	48(%rsp), %rax
+	leaq	_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %r14
+	movdqa	128(%rsp), %xmm7
+	movq	32(%rax), %rax
+	movaps	%xmm7, 368(%rsp)
+	movq	%rax, 352(%rsp)
+	movq	32(%rsp), %rax
+	movq	%rax, 360(%rsp)
+	movzbl	_ZGVZ6perfitRKSt8functionIFvvEEE8counters(%rip), %eax
+	testb	%al, %al
+	jne	.L1174
+	leaq	_ZGVZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rdi
+	leaq	_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %r14
+	call	__cxa_guard_acquire@PLT
+	testl	%eax, %eax
+	jne	.L1561
+.L1174:
+	movq	32+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rax
+	cmpq	%rax, 40+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip)
+	je	.L1176
+	movl	(%r14), %edi
+	movl	$1, %edx
+	movl	$9219, %esi
+	xorl	%eax, %eax
+	call	ioctl@PLT
+	movl	(%r14), %edi
+	movl	$1, %edx
+	xorl	%eax, %eax
+	movl	$9216, %esi
+	call	ioctl@PLT
+.L1176:
+	xorl	%eax, %eax
+	movl	$34, %ecx
 	movq	%r12, %rdi
-	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	movq	4992(%r12), %rax
-.L111:
-	leaq	1(%rax), %rdx
-	movq	(%r12,%rax,8), %rax
-	movq	%rdx, 4992(%r12)
-	movq	%rax, %rdx
-	shrq	$11, %rdx
-	movl	%edx, %edx
-	xorq	%rdx, %rax
-	movq	%rax, %rdx
-	salq	$7, %rdx
-	andl	$2636928640, %edx
-	xorq	%rdx, %rax
-	movq	%rax, %rdx
-	salq	$15, %rdx
-	andl	$4022730752, %edx
-	xorq	%rdx, %rax
-	movq	%rax, %rdx
-	shrq	$18, %rdx
-	xorq	%rdx, %rax
-	addq	%rax, %rbx
-	setc	%al
-	movzbl	%al, %eax
-	cmpq	%rbx, %r13
-	jb	.L118
+	rep stosl
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	cmpq	$0, 368(%rsp)
+	movq	%rax, 72(%rsp)
+	je	.L1562
+	leaq	352(%rsp), %rax
+	movq	%rax, 120(%rsp)
+	movq	%rax, %rdi
+.LEHB100:
+	call	*376(%rsp)
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	movq	72(%rsp), %rsi
+	pxor	%xmm0, %xmm0
+	subq	%rsi, %rax
+	cvtsi2sdq	%rax, %xmm0
+	movq	32+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rax
+	cmpq	%rax, 40+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip)
+	divsd	.LC65(%rip), %xmm0
+	movsd	%xmm0, 72(%rsp)
+	movsd	%xmm0, 528(%rsp)
+	je	.L1180
+	movl	(%r14), %edi
+	xorl	%eax, %eax
+	movl	$1, %edx
+	movl	$9217, %esi
+	call	ioctl@PLT
+	movq	32+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rax
+	cmpq	%rax, 40+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip)
+	je	.L1180
+	movq	40(%rsp), %rsi
+	movl	(%r14), %edi
+	movl	$88, %edx
+	call	read@PLT
+	cmpq	$23, %rax
+	jle	.L1180
+	movq	448(%rsp), %rcx
+	testq	%rcx, %rcx
+	je	.L1180
+	movq	8+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rax
+	cmpq	%rax, 16+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip)
+	je	.L1298
+	xorl	%edx, %edx
+	movl	(%r14), %esi
+	cmpl	%esi, (%rax)
+	setne	%dl
+.L1181:
+	movq	32+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %r10
+	movq	40+_ZZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rax
+	subq	%r10, %rax
+	sarq	$2, %rax
+	leaq	(%rax,%rdx), %rsi
+	cmpq	%rsi, 432(%rsp)
+	je	.L1563
+.L1180:
+	movq	0(%rbp), %rax
+	movq	-24(%rax), %rdi
+	addq	%rbp, %rdi
+	movq	%rdi, %rax
+	movl	24(%rdi), %edi
+	movq	8(%rax), %rax
+	movl	%edi, 112(%rsp)
+	movq	%rbp, %rdi
+	movq	%rax, 96(%rsp)
+	movq	48(%rsp), %rax
+	movq	8(%rax), %rdx
+	movq	(%rax), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$2, %edx
+	leaq	.LC67(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r14
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	(%r14), %rax
+	movsd	72(%rsp), %xmm0
+	movq	%r14, %rdi
+	movq	-24(%rax), %rdx
+	addq	%r14, %rdx
+	movl	24(%rdx), %eax
+	movq	$2, 8(%rdx)
+	andl	$-261, %eax
+	orl	$4, %eax
+	movl	%eax, 24(%rdx)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movl	$5, %edx
+	leaq	.LC68(%rip), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	cmpb	$0, 560(%rsp)
+	movb	$0, 72(%rsp)
+	je	.L1194
+	cmpb	$0, 544(%rsp)
+	je	.L1194
+	movq	536(%rsp), %rax
 	testq	%rax, %rax
-	jne	.L118
-.L109:
-	addq	$8, %rsp
-	.cfi_remember_state
-	.cfi_def_cfa_offset 56
-	leal	0(%rbp,%rbx), %eax
-	popq	%rbx
-	.cfi_def_cfa_offset 48
-	popq	%rbp
-	.cfi_def_cfa_offset 40
-	popq	%r12
-	.cfi_def_cfa_offset 32
-	popq	%r13
-	.cfi_def_cfa_offset 24
-	popq	%r14
-	.cfi_def_cfa_offset 16
-	popq	%r15
-	.cfi_def_cfa_offset 8
-	ret
-	.p2align 4,,10
-	.p2align 3
-.L120:
-	.cfi_restore_state
-	movq	4992(%rdi), %rax
-	addq	$1, %r13
-	movl	%r13d, %r15d
-	cmpq	$623, %rax
-	ja	.L121
-.L105:
-	movq	(%r12,%rax,8), %rbx
-	leaq	1(%rax), %rcx
-	movq	%rcx, 4992(%r12)
-	movq	%rbx, %rax
-	shrq	$11, %rax
-	movl	%eax, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$7, %rax
-	andl	$2636928640, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$15, %rax
-	andl	$4022730752, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	shrq	$18, %rax
-	xorq	%rax, %rbx
-	imulq	%r13, %rbx
-	cmpl	%ebx, %r13d
-	jbe	.L106
-	movl	%r13d, %eax
+	je	.L1194
+	movq	552(%rsp), %rdx
+	testq	%rdx, %rdx
+	js	.L1195
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rdx, %xmm1
+.L1196:
+	testq	%rax, %rax
+	js	.L1197
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L1198:
+	divsd	%xmm0, %xmm1
+	movb	$1, 72(%rsp)
+	movsd	%xmm1, 144(%rsp)
+.L1194:
+	leaq	.LC69(%rip), %r14
+	movl	$2, %edx
+	movq	%rbp, %rdi
+	movq	%r14, %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$3, %edx
+	leaq	.LC70(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$1, %edx
+	leaq	.LC71(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	cmpb	$0, 72(%rsp)
+	je	.L1199
+	movsd	144(%rsp), %xmm0
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+	movq	-24(%rax), %rdx
+	addq	%rbp, %rdx
+	movl	24(%rdx), %eax
+	movq	$2, 8(%rdx)
+	andl	$-261, %eax
+	orl	$4, %eax
+	movl	%eax, 24(%rdx)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
 	xorl	%edx, %edx
-	negl	%eax
-	divl	%r15d
-	movl	%edx, %r14d
-	cmpl	%edx, %ebx
-	jb	.L108
-	jmp	.L106
-	.p2align 4,,10
-	.p2align 3
-.L107:
-	movq	(%r12,%rax,8), %rbx
-	leaq	1(%rax), %rcx
-	movq	%rcx, 4992(%r12)
-	movq	%rbx, %rax
-	shrq	$11, %rax
-	movl	%eax, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$7, %rax
-	andl	$2636928640, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$15, %rax
-	andl	$4022730752, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	shrq	$18, %rax
-	xorq	%rax, %rbx
-	imulq	%r13, %rbx
-	cmpl	%ebx, %r14d
-	jbe	.L106
-.L108:
-	movq	%rcx, %rax
-	cmpq	$623, %rcx
-	jbe	.L107
-	movq	%r12, %rdi
-	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	movq	4992(%r12), %rax
-	jmp	.L107
-	.p2align 4,,10
-	.p2align 3
-.L106:
-	shrq	$32, %rbx
-	jmp	.L109
-	.p2align 4,,10
-	.p2align 3
-.L110:
-	movq	4992(%rdi), %rax
-	cmpq	$623, %rax
-	ja	.L122
-.L115:
-	movq	(%r12,%rax,8), %rbx
-	leaq	1(%rax), %rdx
-	movq	%rdx, 4992(%r12)
-	movq	%rbx, %rax
-	shrq	$11, %rax
-	movl	%eax, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$7, %rax
-	andl	$2636928640, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	salq	$15, %rax
-	andl	$4022730752, %eax
-	xorq	%rax, %rbx
-	movq	%rbx, %rax
-	shrq	$18, %rax
-	xorq	%rax, %rbx
-	jmp	.L109
-	.p2align 4,,10
-	.p2align 3
-.L121:
-	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	movq	4992(%r12), %rax
-	jmp	.L105
-	.p2align 4,,10
-	.p2align 3
-.L122:
-	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	movq	4992(%r12), %rax
-	jmp	.L115
-	.cfi_endproc
-.LFE4499:
-	.size	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0, .-_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
-	.section	.rodata.str1.1,"aMS",@progbits,1
-.LC4:
-	.string	"vector::reserve"
-.LC5:
-	.string	"Elapsed: "
-.LC6:
-	.string	" [\316\274s]"
-	.section	.text.unlikely,"ax",@progbits
-.LCOLDB7:
-	.section	.text.startup,"ax",@progbits
-.LHOTB7:
-	.p2align 4
-	.globl	main
-	.type	main, @function
-main:
-.LFB3557:
-	.cfi_startproc
-	.cfi_personality 0x3,__gxx_personality_v0
-	.cfi_lsda 0x3,.LLSDA3557
-	pushq	%r15
-	.cfi_def_cfa_offset 16
-	.cfi_offset 15, -16
-	pushq	%r14
-	.cfi_def_cfa_offset 24
-	.cfi_offset 14, -24
-	pushq	%r13
-	.cfi_def_cfa_offset 32
-	.cfi_offset 13, -32
-	pushq	%r12
-	.cfi_def_cfa_offset 40
-	.cfi_offset 12, -40
-	pushq	%rbp
-	.cfi_def_cfa_offset 48
-	.cfi_offset 6, -48
-	pushq	%rbx
-	.cfi_def_cfa_offset 56
-	.cfi_offset 3, -56
-	subq	$10136, %rsp
-	.cfi_def_cfa_offset 10192
-	leaq	112(%rsp), %rdi
-.LEHB8:
-	call	_ZNSt13random_deviceC1Ev
-.LEHE8:
-	leaq	112(%rsp), %rdi
-.LEHB9:
-	call	_ZNSt13random_device9_M_getvalEv
-.LEHE9:
-	movl	%eax, %ecx
+	leaq	.LC72(%rip), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+.L1200:
+	cmpb	$0, 592(%rsp)
+	movb	$0, 72(%rsp)
+	je	.L1201
+	cmpb	$0, 576(%rsp)
+	je	.L1201
+	movq	568(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1201
+	movq	584(%rsp), %rdx
+	testq	%rdx, %rdx
+	js	.L1202
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rdx, %xmm1
+.L1203:
+	testq	%rax, %rax
+	js	.L1204
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L1205:
+	divsd	%xmm0, %xmm1
+	movb	$1, 72(%rsp)
+	movsd	%xmm1, 152(%rsp)
+.L1201:
+	movl	$2, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$13, %edx
+	leaq	.LC74(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
 	movl	$1, %edx
-	movq	%rcx, 5120(%rsp)
-	.p2align 4,,10
-	.p2align 3
-.L124:
-	movq	%rcx, %rax
-	shrq	$30, %rax
-	xorq	%rcx, %rax
-	imulq	$1812433253, %rax, %rax
-	leal	(%rax,%rdx), %ecx
-	movq	%rcx, 5120(%rsp,%rdx,8)
-	addq	$1, %rdx
-	cmpq	$624, %rdx
-	jne	.L124
+	leaq	.LC71(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	cmpb	$0, 72(%rsp)
+	je	.L1206
+	movsd	152(%rsp), %xmm0
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+	mulsd	.LC75(%rip), %xmm0
+	movq	-24(%rax), %rdx
+	addq	%rbp, %rdx
+	movl	24(%rdx), %eax
+	movq	$2, 8(%rdx)
+	andl	$-261, %eax
+	orl	$4, %eax
+	movl	%eax, 24(%rdx)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movl	$1, %edx
+	leaq	.LC76(%rip), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+.L1207:
+	cmpb	$0, 624(%rsp)
+	movb	$0, 72(%rsp)
+	je	.L1208
+	cmpb	$0, 608(%rsp)
+	je	.L1208
+	movq	600(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1208
+	movq	616(%rsp), %rdx
+	testq	%rdx, %rdx
+	js	.L1209
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rdx, %xmm1
+.L1210:
+	testq	%rax, %rax
+	js	.L1211
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L1212:
+	divsd	%xmm0, %xmm1
+	movb	$1, 72(%rsp)
+	movsd	%xmm1, 160(%rsp)
+.L1208:
+	movl	$2, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$10, %edx
+	leaq	.LC77(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$1, %edx
+	leaq	.LC71(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	cmpb	$0, 72(%rsp)
+	je	.L1213
+	movsd	160(%rsp), %xmm0
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+	mulsd	.LC75(%rip), %xmm0
+	movq	-24(%rax), %rdx
+	addq	%rbp, %rdx
+	movl	24(%rdx), %eax
+	movq	$2, 8(%rdx)
+	andl	$-261, %eax
+	orl	$4, %eax
+	movl	%eax, 24(%rdx)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movl	$1, %edx
+	leaq	.LC76(%rip), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+.L1214:
+	cmpb	$0, 656(%rsp)
+	movb	$0, 72(%rsp)
+	je	.L1215
+	cmpb	$0, 640(%rsp)
+	je	.L1215
+	movq	632(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1215
+	movq	648(%rsp), %rdx
+	testq	%rdx, %rdx
+	js	.L1216
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rdx, %xmm1
+.L1217:
+	testq	%rax, %rax
+	js	.L1218
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rax, %xmm0
+.L1219:
+	divsd	%xmm0, %xmm1
+	movb	$1, 72(%rsp)
+	movsd	%xmm1, 168(%rsp)
+.L1215:
+	movl	$2, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$10, %edx
+	leaq	.LC78(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	$1, %edx
+	leaq	.LC71(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	cmpb	$0, 72(%rsp)
+	je	.L1220
+	movsd	168(%rsp), %xmm0
+	movq	0(%rbp), %rax
+	movq	%rbp, %rdi
+	mulsd	.LC75(%rip), %xmm0
+	movq	-24(%rax), %rdx
+	addq	%rbp, %rdx
+	movl	24(%rdx), %eax
+	movq	$2, 8(%rdx)
+	andl	$-261, %eax
+	orl	$4, %eax
+	movl	%eax, 24(%rdx)
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movq	%rax, %rdi
+	movl	$1, %edx
+	leaq	.LC76(%rip), %rsi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+.L1221:
+	movq	0(%rbp), %rax
+	movq	-24(%rax), %rax
+	movq	240(%rbp,%rax), %r14
+	testq	%r14, %r14
+	je	.L1564
+	cmpb	$0, 56(%r14)
+	je	.L1223
+	movzbl	67(%r14), %eax
+.L1224:
+	movsbl	%al, %esi
+	movq	%rbp, %rdi
+	call	_ZNSo3putEc@PLT
+	movq	%rax, %rdi
+	call	_ZNSo5flushEv@PLT
+.LEHE100:
+	movq	0(%rbp), %rax
+	movq	96(%rsp), %rdi
+	movq	-24(%rax), %rsi
+	addq	%rbp, %rsi
+	movq	%rsi, %rax
+	movl	112(%rsp), %esi
+	movq	%rdi, 8(%rax)
+	movl	%esi, 24(%rax)
+	movq	368(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1225
+	movq	120(%rsp), %rdi
+	movl	$3, %edx
+	movq	%rdi, %rsi
+	call	*%rax
+.L1225:
+	addq	$40, 48(%rsp)
+	jmp	.L1171
+.L1554:
+.LEHB101:
+	call	_ZSt25__throw_bad_function_callv@PLT
+.LEHE101:
+.L1555:
+.LEHB102:
+	call	_ZSt25__throw_bad_function_callv@PLT
+.LEHE102:
+.L1166:
+	movq	%r14, %rdi
+.LEHB103:
+	call	_ZNKSt5ctypeIcE13_M_widen_initEv@PLT
+	movq	(%r14), %rax
+	leaq	_ZNKSt5ctypeIcE8do_widenEc(%rip), %rcx
+	movq	48(%rax), %rdx
+	movl	$10, %eax
+	cmpq	%rcx, %rdx
+	je	.L1167
+	movl	$10, %esi
+	movq	%r14, %rdi
+	call	*%rdx
+	jmp	.L1167
+.L1556:
+	call	_ZSt16__throw_bad_castv@PLT
+.LEHE103:
+.L1223:
+	movq	%r14, %rdi
+.LEHB104:
+	call	_ZNKSt5ctypeIcE13_M_widen_initEv@PLT
+	movq	(%r14), %rax
+	leaq	_ZNKSt5ctypeIcE8do_widenEc(%rip), %rcx
+	movq	48(%rax), %rdx
+	movl	$10, %eax
+	cmpq	%rcx, %rdx
+	je	.L1224
+	movl	$10, %esi
+	movq	%r14, %rdi
+	call	*%rdx
+	jmp	.L1224
+.L1564:
+	call	_ZSt16__throw_bad_castv@PLT
+.L1220:
+	movl	$3, %edx
+	leaq	.LC73(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	jmp	.L1221
+.L1213:
+	movl	$3, %edx
+	leaq	.LC73(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	jmp	.L1214
+.L1206:
+	movl	$3, %edx
+	leaq	.LC73(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	jmp	.L1207
+.L1199:
+	movl	$3, %edx
+	leaq	.LC73(%rip), %rsi
+	movq	%rbp, %rdi
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	jmp	.L1200
+.L1218:
+	movq	%rax, %rdx
+	andl	$1, %eax
 	pxor	%xmm0, %xmm0
-	leaq	48(%rsp), %rax
-	movl	$2400000, %edi
-	movq	$624, 10112(%rsp)
-	movq	$0, 64(%rsp)
-	movq	%rax, 40(%rsp)
-	movaps	%xmm0, 48(%rsp)
-.LEHB10:
-	call	_Znwm
-.LEHE10:
-	movq	%rax, %xmm0
-	addq	$2400000, %rax
-	movl	$100000, 36(%rsp)
-	movq	%rax, 64(%rsp)
-	leaq	48(%rsp), %rax
-	punpcklqdq	%xmm0, %xmm0
-	movq	%rax, 40(%rsp)
-	movaps	%xmm0, 48(%rsp)
-	.p2align 4,,10
-	.p2align 3
-.L150:
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L1219
+.L1216:
+	movq	%rdx, %rcx
+	andl	$1, %edx
 	pxor	%xmm0, %xmm0
-	movl	$50, %edx
-	movl	$5, %esi
-	movq	$0, 96(%rsp)
-	leaq	5120(%rsp), %rdi
-	movaps	%xmm0, 80(%rsp)
-	call	_ZNSt24uniform_int_distributionIiEclISt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EEEEiRT_RKNS0_10param_typeE.isra.0
-	movslq	%eax, %r12
-	movq	%r12, %r14
-	testl	%r12d, %r12d
-	js	.L210
-	xorl	%r15d, %r15d
-	testq	%r12, %r12
-	jne	.L211
-	movq	56(%rsp), %rbp
-	cmpq	64(%rsp), %rbp
-	je	.L142
-	.p2align 4,,10
-	.p2align 3
-.L215:
-	movq	80(%rsp), %r12
+	shrq	%rcx
+	orq	%rdx, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	movapd	%xmm0, %xmm1
+	addsd	%xmm0, %xmm1
+	jmp	.L1217
+.L1562:
+	call	_ZSt25__throw_bad_function_callv@PLT
+.LEHE104:
+.L1197:
+	movq	%rax, %rdx
+	andl	$1, %eax
 	pxor	%xmm0, %xmm0
-	movq	$0, 16(%rbp)
-	movups	%xmm0, 0(%rbp)
-	subq	%r12, %r15
-	je	.L143
-	js	.L212
-	movq	%r15, %rdi
-.LEHB11:
-	call	_Znwm
-.LEHE11:
-	movq	%rax, %xmm0
-	leaq	(%rax,%r15), %rbx
-	movq	%rax, %rdi
-	punpcklqdq	%xmm0, %xmm0
-	movq	%rbx, 16(%rbp)
-	movups	%xmm0, 0(%rbp)
-	testq	%r15, %r15
-	je	.L145
-	movq	%r15, %rdx
-	movq	%r12, %rsi
-	call	memmove
-.L145:
-	movq	%rbx, 8(%rbp)
-	addq	$24, %rbp
-	movq	%rbp, 56(%rsp)
-.L146:
-	testq	%r12, %r12
-	je	.L147
-	movq	96(%rsp), %rsi
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L1198
+.L1195:
+	movq	%rdx, %rcx
+	andl	$1, %edx
+	pxor	%xmm0, %xmm0
+	shrq	%rcx
+	orq	%rdx, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	movapd	%xmm0, %xmm1
+	addsd	%xmm0, %xmm1
+	jmp	.L1196
+.L1204:
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm0, %xmm0
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L1205
+.L1202:
+	movq	%rdx, %rcx
+	andl	$1, %edx
+	pxor	%xmm0, %xmm0
+	shrq	%rcx
+	orq	%rdx, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	movapd	%xmm0, %xmm1
+	addsd	%xmm0, %xmm1
+	jmp	.L1203
+.L1211:
+	movq	%rax, %rdx
+	andl	$1, %eax
+	pxor	%xmm0, %xmm0
+	shrq	%rdx
+	orq	%rax, %rdx
+	cvtsi2sdq	%rdx, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L1212
+.L1209:
+	movq	%rdx, %rcx
+	andl	$1, %edx
+	pxor	%xmm0, %xmm0
+	shrq	%rcx
+	orq	%rdx, %rcx
+	cvtsi2sdq	%rcx, %xmm0
+	movapd	%xmm0, %xmm1
+	addsd	%xmm0, %xmm1
+	jmp	.L1210
+.L1543:
+	movq	416(%rsp), %r14
+	leaq	0(,%rax,8), %r12
 	movq	%r12, %rdi
-	subq	%r12, %rsi
-	call	_ZdlPvm
-	subl	$1, 36(%rsp)
-	jne	.L150
-.L149:
-	xorl	%r13d, %r13d
-.L160:
-	call	_ZNSt6chrono3_V212system_clock3nowEv
-	movq	56(%rsp), %r14
-	movq	48(%rsp), %rbx
+	subq	%rcx, %r14
+.LEHB105:
+	call	_Znwm@PLT
+	movq	408(%rsp), %r13
+	movq	416(%rsp), %rdx
 	movq	%rax, %r15
-	jmp	.L151
-.L154:
-	movl	%edx, %esi
+	movq	424(%rsp), %rax
+	subq	%r13, %rdx
+	movq	%rax, 24(%rsp)
+	testq	%rdx, %rdx
+	jg	.L1565
+	testq	%r13, %r13
+	jne	.L1101
+.L1102:
+	addq	%r15, %r14
+	movq	%r15, 408(%rsp)
+	addq	%r12, %r15
+	movq	%r14, 416(%rsp)
+	movq	%r15, 424(%rsp)
+	jmp	.L1099
+.L1542:
+	leaq	.LC43(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE105:
+.L1228:
+	movzbl	0(%r13,%rax), %ecx
+	movb	%cl, (%rdx,%rax)
+	addq	$1, %rax
+.L1226:
+	movq	24(%rsp), %rsi
+	cmpq	%rsi, %rax
+	jne	.L1228
+	leaq	.LC79(%rip), %rax
+	movq	%r12, %r14
+	movq	%rax, 528(%rsp)
+	leaq	_Z16all_alnum_scalarPKci(%rip), %rax
+	movq	%rax, 536(%rsp)
+	leaq	.LC80(%rip), %rax
+	movq	%rax, 544(%rsp)
+	leaq	_Z9all_alnumPKci(%rip), %rax
+	movq	%rax, 552(%rsp)
+	leaq	560(%rsp), %rax
+	movq	%rax, 72(%rsp)
+.L1236:
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	xorl	%r15d, %r15d
+	xorl	%r12d, %r12d
+	movq	%rax, 48(%rsp)
+	movq	416(%rsp), %rax
+	subq	408(%rsp), %rax
+	sarq	$3, %rax
+	subq	$1, %rax
+	movq	%rax, 40(%rsp)
+	jmp	.L1229
+.L1230:
+	movq	408(%rsp), %rdx
+	leaq	0(,%r12,8), %rcx
+	movq	384(%rsp), %rdi
+	movq	(%rdx,%r12,8), %rax
+	movq	8(%rdx,%rcx), %rsi
+	addq	$1, %r12
+	addq	%rax, %rdi
+	subl	%eax, %esi
+.LEHB106:
+	call	*8(%r14)
+	movzbl	%al, %eax
+	addl	%eax, %r15d
+.L1229:
+	movq	40(%rsp), %rax
+	cmpq	%rax, %r12
+	jne	.L1230
+	call	_ZNSt6chrono3_V212system_clock3nowEv@PLT
+	movq	48(%rsp), %rdi
+	movq	(%r14), %rsi
+	subq	%rdi, %rax
+	movq	%rax, %r12
+	testq	%rsi, %rsi
+	je	.L1566
+	movq	%rsi, %rdi
+	movq	%rsi, 40(%rsp)
+	call	strlen@PLT
+	movq	40(%rsp), %rsi
 	movq	%rbp, %rdi
-.LEHB12:
-	call	*C.1.0(%r13)
-.LEHE12:
-	testq	%rbp, %rbp
-	je	.L155
-	movq	%r12, %rsi
+	movq	%rax, %rdx
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+.L1232:
+	movl	$2, %edx
+	leaq	.LC67(%rip), %rsi
 	movq	%rbp, %rdi
-	call	_ZdlPvm
-.L155:
-	addq	$24, %rbx
-.L151:
-	cmpq	%rbx, %r14
-	je	.L213
-	movq	8(%rbx), %r12
-	subq	(%rbx), %r12
-	je	.L171
-	js	.L214
-	movq	%r12, %rdi
-.LEHB13:
-	call	_Znwm
-.LEHE13:
-	movq	%rax, %rbp
-.L152:
-	movq	(%rbx), %rsi
-	movq	8(%rbx), %rdx
-	subq	%rsi, %rdx
-	je	.L154
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	pxor	%xmm0, %xmm0
+	pxor	%xmm1, %xmm1
 	movq	%rbp, %rdi
-	movq	%rdx, 16(%rsp)
-	call	memmove
-	movq	16(%rsp), %rdx
-	jmp	.L154
-	.p2align 4,,10
-	.p2align 3
-.L147:
-	subl	$1, 36(%rsp)
-	jne	.L150
-	jmp	.L149
-	.p2align 4,,10
-	.p2align 3
-.L211:
+	cvtsi2sdq	(%rsp), %xmm0
+	cvtsi2sdq	%r12, %xmm1
+	divsd	%xmm1, %xmm0
+	call	_ZNSo9_M_insertIdEERSoT_@PLT
+	movl	$9, %edx
+	leaq	.LC81(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %r12
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movl	%r15d, %esi
 	movq	%r12, %rdi
-.LEHB14:
-	call	_Znwm
-	addq	%rax, %r12
-	movq	%rax, %xmm0
-	movq	%rax, %r15
-	xorl	%ebp, %ebp
-	movq	%r12, 96(%rsp)
-	punpcklqdq	%xmm0, %xmm0
-	movaps	%xmm0, 80(%rsp)
-	.p2align 4,,10
-	.p2align 3
-.L141:
-	movq	10112(%rsp), %rax
-	cmpq	$623, %rax
-	ja	.L209
-	.p2align 4,,10
-	.p2align 3
-.L127:
-	leaq	1(%rax), %rdx
-	movq	%rdx, 10112(%rsp)
-	movq	5120(%rsp,%rax,8), %rax
-	movq	%rax, %rsi
-	shrq	$11, %rsi
-	movl	%esi, %esi
-	xorq	%rsi, %rax
-	movq	%rax, %rsi
-	salq	$7, %rsi
-	andl	$2636928640, %esi
-	xorq	%rsi, %rax
-	movq	%rax, %rsi
-	salq	$15, %rsi
-	andl	$4022730752, %esi
-	xorq	%rsi, %rax
-	movq	%rax, %rsi
-	shrq	$18, %rsi
-	xorq	%rsi, %rax
-	movq	%rax, %rbx
-	salq	$6, %rbx
-	subq	%rax, %rbx
-	cmpl	$3, %ebx
-	ja	.L128
-	movq	%rdx, %rax
-	cmpq	$623, %rdx
-	jbe	.L127
-.L209:
-	leaq	5120(%rsp), %rdi
-	call	_ZNSt23mersenne_twister_engineImLm32ELm624ELm397ELm31ELm2567483615ELm11ELm4294967295ELm7ELm2636928640ELm15ELm4022730752ELm18ELm1812433253EE11_M_gen_randEv
-	movq	10112(%rsp), %rax
-	jmp	.L127
-	.p2align 4,,10
-	.p2align 3
-.L128:
-	shrq	$32, %rbx
-	cmpq	%r15, %r12
-	je	.L131
-	movslq	%ebx, %rbx
-	addq	$1, %r15
-	movzbl	_ZL8alphanum(%rbx), %eax
-	movb	%al, -1(%r15)
-	movq	%r15, 88(%rsp)
-.L132:
-	addl	$1, %ebp
-	cmpl	%r14d, %ebp
-	jl	.L141
-	movq	56(%rsp), %rbp
-	cmpq	64(%rsp), %rbp
-	jne	.L215
-.L142:
-	movq	40(%rsp), %rdi
-	leaq	80(%rsp), %rdx
-	movq	%rbp, %rsi
-	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EE17_M_realloc_insertIJRKS1_EEEvN9__gnu_cxx17__normal_iteratorIPS1_S3_EEDpOT_
-	movq	80(%rsp), %r12
-	jmp	.L146
-	.p2align 4,,10
-	.p2align 3
-.L131:
-	movq	80(%rsp), %rax
-	movq	%r12, %r13
-	movq	%rax, 16(%rsp)
-	subq	%rax, %r13
-	movabsq	$9223372036854775807, %rax
-	cmpq	%rax, %r13
-	je	.L216
-	testq	%r13, %r13
-	movl	$1, %eax
-	cmovne	%r13, %rax
-	addq	%r13, %rax
-	jc	.L135
-	xorl	%r8d, %r8d
-	xorl	%edi, %edi
-	testq	%rax, %rax
-	jne	.L217
-.L137:
-	movslq	%ebx, %rbx
-	leaq	1(%rdi,%r13), %r15
-	movq	%rdi, %xmm0
-	movzbl	_ZL8alphanum(%rbx), %eax
-	movq	%r15, %xmm1
-	punpcklqdq	%xmm1, %xmm0
-	movb	%al, (%rdi,%r13)
-	testq	%r13, %r13
-	jg	.L218
-	cmpq	$0, 16(%rsp)
-	jne	.L139
-.L140:
-	movq	%r8, 96(%rsp)
-	movq	%r8, %r12
-	movaps	%xmm0, 80(%rsp)
-	jmp	.L132
-	.p2align 4,,10
-	.p2align 3
-.L218:
-	movq	16(%rsp), %rsi
-	movq	%r13, %rdx
-	movq	%r8, 24(%rsp)
-	movaps	%xmm0, (%rsp)
-	call	memmove
-	movdqa	(%rsp), %xmm0
-	movq	24(%rsp), %r8
-.L139:
-	movq	16(%rsp), %rdi
-	movq	%r12, %rsi
-	movq	%r8, 24(%rsp)
-	movaps	%xmm0, (%rsp)
-	subq	%rdi, %rsi
-	call	_ZdlPvm
-	movq	24(%rsp), %r8
-	movdqa	(%rsp), %xmm0
-	jmp	.L140
-	.p2align 4,,10
-	.p2align 3
-.L217:
-	movabsq	$9223372036854775807, %rdx
-	cmpq	%rdx, %rax
-	cmovbe	%rax, %rdx
-	movq	%rdx, %rax
-.L136:
+	call	_ZNSo9_M_insertImEERSoT_@PLT
+	movl	$14, %edx
+	leaq	.LC82(%rip), %rsi
 	movq	%rax, %rdi
 	movq	%rax, %r15
-	call	_Znwm
-	movq	%r15, %r8
-	movq	%rax, %rdi
-	addq	%rax, %r8
-	jmp	.L137
-	.p2align 4,,10
-	.p2align 3
-.L143:
-	movq	$0, 0(%rbp)
-	xorl	%ebx, %ebx
-	movq	$0, 16(%rbp)
-	jmp	.L145
-.L212:
-	call	_ZSt17__throw_bad_allocv
-.LEHE14:
-.L171:
-	xorl	%ebp, %ebp
-	jmp	.L152
-.L213:
-	call	_ZNSt6chrono3_V212system_clock3nowEv
-	movl	$1000, %ecx
-	movl	$.LC5, %esi
-	movl	$_ZSt4cout, %edi
-	subq	%r15, %rax
-	cqto
-	idivq	%rcx
-	movl	$9, %edx
-	movq	%rax, %rbp
-.LEHB15:
-	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l
-	movq	%rbp, %rsi
-	movl	$_ZSt4cout, %edi
-	call	_ZNSo9_M_insertIlEERSoT_
-	movl	$6, %edx
-	movl	$.LC6, %esi
-	movq	%rax, %rdi
-	movq	%rax, %rbp
-	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l
-	movq	0(%rbp), %rax
+	call	_ZSt16__ostream_insertIcSt11char_traitsIcEERSt13basic_ostreamIT_T0_ES6_PKS3_l@PLT
+	movq	(%r15), %rax
 	movq	-24(%rax), %rax
-	movq	240(%rbp,%rax), %r12
+	movq	240(%r15,%rax), %r12
 	testq	%r12, %r12
-	je	.L219
+	je	.L1567
 	cmpb	$0, 56(%r12)
-	je	.L158
+	je	.L1234
 	movzbl	67(%r12), %eax
-.L159:
+.L1235:
 	movsbl	%al, %esi
-	movq	%rbp, %rdi
-	call	_ZNSo3putEc
+	movq	%r15, %rdi
+	call	_ZNSo3putEc@PLT
 	movq	%rax, %rdi
-	call	_ZNSo5flushEv
-.LEHE15:
-	addq	$8, %r13
-	cmpq	$16, %r13
-	jne	.L160
-	movq	40(%rsp), %rdi
+	call	_ZNSo5flushEv@PLT
+.LEHE106:
+	movq	72(%rsp), %rax
+	addq	$16, %r14
+	cmpq	%rax, %r14
+	jne	.L1236
+	movq	80(%rsp), %rdi
+	call	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED1Ev
+	testq	%r13, %r13
+	je	.L1237
+	movq	24(%rsp), %rsi
+	movq	%r13, %rdi
+	call	_ZdlPvm@PLT
+.L1237:
+	movq	64(%rsp), %rdi
 	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
-	leaq	112(%rsp), %rdi
-	call	_ZNSt13random_device7_M_finiEv
-	addq	$10136, %rsp
+	movq	32(%rsp), %rdi
+	call	_ZN10StringPoolD1Ev
+	movq	88(%rsp), %rdi
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
+	movq	%rbx, %rdi
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
+	movq	56(%rsp), %rdi
+	call	_ZNSt13random_device7_M_finiEv@PLT
+	addq	$10712, %rsp
 	.cfi_remember_state
 	.cfi_def_cfa_offset 56
 	xorl	%eax, %eax
@@ -1496,193 +9030,1101 @@ main:
 	popq	%r15
 	.cfi_def_cfa_offset 8
 	ret
-.L214:
+.L1561:
 	.cfi_restore_state
-.LEHB16:
-	call	_ZSt17__throw_bad_allocv
-.L158:
+	movq	%r14, %rdi
+.LEHB107:
+	call	_ZN4perf8CountersC1Ev
+.LEHE107:
+	leaq	__dso_handle(%rip), %rdx
+	movq	%r14, %rsi
+	leaq	_ZN4perf8CountersD1Ev(%rip), %rdi
+	call	__cxa_atexit@PLT
+	leaq	_ZGVZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rdi
+	call	__cxa_guard_release@PLT
+	jmp	.L1174
+.L1563:
+	movq	40(%rsp), %rdi
+	movq	440(%rsp), %r8
+	xorl	%esi, %esi
+	movabsq	$-9223372036854775808, %r14
+	movsd	.LC66(%rip), %xmm2
+	leaq	(%rdi,%rdx,8), %r11
+	movq	%r8, %rdi
+	andl	$1, %edi
+	movq	%rdi, 112(%rsp)
+	movq	%rcx, %rdi
+	andl	$1, %edi
+	movq	%rdi, 96(%rsp)
+	jmp	.L1182
+.L1568:
+	cvttsd2siq	%xmm0, %rdi
+	movq	%rdi, (%rdx)
+.L1190:
+	movb	$1, 8(%rdx)
+	addq	$1, %rsi
+.L1182:
+	cmpq	%rsi, %rax
+	je	.L1180
+	movl	(%r10,%rsi,4), %edx
+	movq	24(%r11,%rsi,8), %rdi
+	salq	$4, %rdx
+	leaq	8(%r12,%rdx), %rdx
+	testq	%rdi, %rdi
+	js	.L1183
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%rdi, %xmm0
+.L1184:
+	testq	%r8, %r8
+	js	.L1185
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%r8, %xmm1
+.L1186:
+	mulsd	%xmm1, %xmm0
+	testq	%rcx, %rcx
+	js	.L1187
+	pxor	%xmm1, %xmm1
+	cvtsi2sdq	%rcx, %xmm1
+.L1188:
+	divsd	%xmm1, %xmm0
+	comisd	%xmm2, %xmm0
+	jb	.L1568
+	subsd	%xmm2, %xmm0
+	cvttsd2siq	%xmm0, %rdi
+	movq	%rdi, (%rdx)
+	xorq	%r14, (%rdx)
+	jmp	.L1190
+.L1298:
+	movl	$1, %edx
+	jmp	.L1181
+.L1187:
+	movq	96(%rsp), %r9
+	movq	%rcx, %rdi
+	pxor	%xmm1, %xmm1
+	shrq	%rdi
+	orq	%r9, %rdi
+	cvtsi2sdq	%rdi, %xmm1
+	addsd	%xmm1, %xmm1
+	jmp	.L1188
+.L1185:
+	movq	112(%rsp), %r9
+	movq	%r8, %rdi
+	pxor	%xmm1, %xmm1
+	shrq	%rdi
+	orq	%r9, %rdi
+	cvtsi2sdq	%rdi, %xmm1
+	addsd	%xmm1, %xmm1
+	jmp	.L1186
+.L1183:
+	movq	%rdi, %r9
+	andl	$1, %edi
+	pxor	%xmm0, %xmm0
+	shrq	%r9
+	orq	%rdi, %r9
+	cvtsi2sdq	%r9, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L1184
+.L1565:
+	movq	%r13, %rsi
+	movq	%r15, %rdi
+	call	memmove@PLT
+.L1101:
+	movq	24(%rsp), %rsi
+	movq	%r13, %rdi
+	subq	%r13, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1102
+.L1269:
+	movq	%r10, %rdx
+	movq	%r13, %rsi
+	xorl	%edi, %edi
+	movq	%r10, 24(%rsp)
+	call	memmove@PLT
+	movq	48(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	movq	%r12, %rdx
+	call	memmove@PLT
+	xorl	%edx, %edx
+	movq	%rdx, 24(%rsp)
+.L1122:
+	movq	80(%rsp), %rsi
+	movq	%r13, %rdi
+	subq	%r13, %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1118
+.L1549:
+	movabsq	$9223372036854775807, %rax
+	cmpq	%rax, %r15
+	cmova	%rax, %r15
+.L1114:
+	movq	%r15, %rdi
+.LEHB108:
+	call	_Znwm@PLT
+	movq	384(%rsp), %r13
+	movq	%r14, %rdx
+	movq	392(%rsp), %rcx
+	movq	%rax, 24(%rsp)
+	movq	400(%rsp), %rsi
+	subq	%r13, %rdx
+	subq	%r14, %rcx
+	leaq	(%rax,%rdx), %r8
+	movq	%rsi, 80(%rsp)
+	leaq	(%r8,%r12), %r9
+	leaq	(%r9,%rcx), %rax
+	movq	%rax, 72(%rsp)
+	testq	%rdx, %rdx
+	je	.L1116
+	movq	24(%rsp), %rdi
+	movq	%r13, %rsi
+	movq	%rcx, 120(%rsp)
+	movq	%r9, 128(%rsp)
+	movq	%r8, 96(%rsp)
+	call	memmove@PLT
+	movq	48(%rsp), %rsi
+	movq	96(%rsp), %rdi
+	movq	%r12, %rdx
+	call	memmove@PLT
+	movq	120(%rsp), %rcx
+	movq	128(%rsp), %r9
+	testq	%rcx, %rcx
+	je	.L1122
+	movq	%rcx, %rdx
+	movq	%r14, %rsi
+	movq	%r9, %rdi
+	call	memmove@PLT
+	jmp	.L1122
+.L1293:
+	movabsq	$9223372036854775807, %r15
+	jmp	.L1114
+.L1548:
+	leaq	.LC55(%rip), %rdi
+	call	_ZSt20__throw_length_errorPKc@PLT
+.LEHE108:
+.L1121:
+	movq	%rcx, %rdx
+	movq	%r14, %rsi
+	movq	%r9, %rdi
+	call	memmove@PLT
+	jmp	.L1120
+.L1234:
 	movq	%r12, %rdi
-	call	_ZNKSt5ctypeIcE13_M_widen_initEv
+.LEHB109:
+	call	_ZNKSt5ctypeIcE13_M_widen_initEv@PLT
 	movq	(%r12), %rax
+	leaq	_ZNKSt5ctypeIcE8do_widenEc(%rip), %rcx
 	movq	48(%rax), %rdx
 	movl	$10, %eax
-	cmpq	$_ZNKSt5ctypeIcE8do_widenEc, %rdx
-	je	.L159
+	cmpq	%rcx, %rdx
+	je	.L1235
 	movl	$10, %esi
 	movq	%r12, %rdi
 	call	*%rdx
-	jmp	.L159
-.L219:
-	call	_ZSt16__throw_bad_castv
-.LEHE16:
-.L135:
-	movabsq	$9223372036854775807, %rax
-	jmp	.L136
-.L216:
-	movl	$.LC3, %edi
-.LEHB17:
-	call	_ZSt20__throw_length_errorPKc
-.L210:
-	movl	$.LC4, %edi
-	call	_ZSt20__throw_length_errorPKc
-.LEHE17:
-.L176:
-	movq	%rax, %rbx
-	jmp	.L164
-.L175:
-	movq	%rax, %rbx
-	jmp	.L161
-.L174:
-	movq	%rax, %rbx
-	jmp	.L163
-.L173:
-	movq	%rax, %rbx
-	jmp	.L166
-	.section	.gcc_except_table,"a",@progbits
-.LLSDA3557:
-	.byte	0xff
+	jmp	.L1235
+.L1567:
+	call	_ZSt16__throw_bad_castv@PLT
+.L1566:
+	movq	0(%rbp), %rax
+	movq	-24(%rax), %rdi
+	addq	%rbp, %rdi
+	movl	32(%rdi), %esi
+	orl	$1, %esi
+	call	_ZNSt9basic_iosIcSt11char_traitsIcEE5clearESt12_Ios_Iostate@PLT
+.LEHE109:
+	jmp	.L1232
+.L1327:
+	movq	%rax, %rbp
+	jmp	.L1193
+.L1315:
+	movq	%rax, %rbp
+	jmp	.L1239
+.L1334:
+	movq	%rax, %rbp
+	jmp	.L1192
+.L1322:
+	movq	%rax, %rbp
+	jmp	.L1256
+.L1319:
+	movq	%rax, %rbp
+	jmp	.L1266
+.L1337:
+	movq	%rax, %rbp
+	jmp	.L1512
+.L1320:
+	movq	%rax, %rbp
+	jmp	.L1265
+.L1321:
+	movq	%rax, %rbp
+	jmp	.L1148
+.L1342:
+	movq	%rax, %rbp
+	jmp	.L1144
+.L1341:
+	movq	%rax, %rbp
+	jmp	.L1146
+.L1343:
+	movq	%rax, %rbp
+	jmp	.L1142
+.L1326:
+	movq	%rax, %rbp
+	jmp	.L1261
+.L1324:
+	movq	%rax, %rbp
+	jmp	.L1257
+.L1325:
+	movq	%rax, %rbp
+	jmp	.L1259
+.L1323:
+	movq	%rax, %rbp
+	jmp	.L1254
+.L1317:
+	movq	%rax, %rbp
+	jmp	.L1244
+.L1318:
+	movq	%rax, %rbp
+	jmp	.L1248
+.L1329:
+	movq	%rax, %rdi
+	jmp	.L1006
+.L1335:
+	movq	%rax, %rbp
+	jmp	.L1011
+.L1339:
+	movq	%rax, %rbp
+	jmp	.L1247
+.L1316:
+	movq	%rax, %rbp
+	jmp	.L1243
+.L1314:
+	movq	%rax, %rbp
+	jmp	.L1267
+.L1338:
+	movq	%rax, %r13
+	jmp	.L1242
+.L1331:
+	movq	%rax, %rdi
+	jmp	.L1039
+.L1336:
+	movq	%rax, %r13
+	jmp	.L1268
+.L1333:
+	movq	%rax, %rdi
+	jmp	.L1062
+.L1340:
+	movq	%rax, %r13
+	jmp	.L1044
+	.section	.gcc_except_table
+	.align 4
+.LLSDA12690:
 	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATT12690-.LLSDATTD12690
+.LLSDATTD12690:
 	.byte	0x1
-	.uleb128 .LLSDACSE3557-.LLSDACSB3557
-.LLSDACSB3557:
-	.uleb128 .LEHB8-.LFB3557
-	.uleb128 .LEHE8-.LEHB8
+	.uleb128 .LLSDACSE12690-.LLSDACSB12690
+.LLSDACSB12690:
+	.uleb128 .LEHB50-.LFB12690
+	.uleb128 .LEHE50-.LEHB50
 	.uleb128 0
 	.uleb128 0
-	.uleb128 .LEHB9-.LFB3557
-	.uleb128 .LEHE9-.LEHB9
-	.uleb128 .L173-.LFB3557
+	.uleb128 .LEHB51-.LFB12690
+	.uleb128 .LEHE51-.LEHB51
+	.uleb128 .L1314-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB10-.LFB3557
-	.uleb128 .LEHE10-.LEHB10
-	.uleb128 .L174-.LFB3557
+	.uleb128 .LEHB52-.LFB12690
+	.uleb128 .LEHE52-.LEHB52
+	.uleb128 .L1315-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB11-.LFB3557
-	.uleb128 .LEHE11-.LEHB11
-	.uleb128 .L175-.LFB3557
+	.uleb128 .LEHB53-.LFB12690
+	.uleb128 .LEHE53-.LEHB53
+	.uleb128 .L1329-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB54-.LFB12690
+	.uleb128 .LEHE54-.LEHB54
+	.uleb128 .L1315-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB12-.LFB3557
-	.uleb128 .LEHE12-.LEHB12
-	.uleb128 .L176-.LFB3557
+	.uleb128 .LEHB55-.LFB12690
+	.uleb128 .LEHE55-.LEHB55
+	.uleb128 .L1340-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB13-.LFB3557
-	.uleb128 .LEHE13-.LEHB13
-	.uleb128 .L174-.LFB3557
+	.uleb128 .LEHB56-.LFB12690
+	.uleb128 .LEHE56-.LEHB56
+	.uleb128 .L1316-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB14-.LFB3557
-	.uleb128 .LEHE14-.LEHB14
-	.uleb128 .L175-.LFB3557
+	.uleb128 .LEHB57-.LFB12690
+	.uleb128 .LEHE57-.LEHB57
+	.uleb128 .L1338-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB15-.LFB3557
-	.uleb128 .LEHE15-.LEHB15
-	.uleb128 .L174-.LFB3557
+	.uleb128 .LEHB58-.LFB12690
+	.uleb128 .LEHE58-.LEHB58
+	.uleb128 .L1336-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB16-.LFB3557
-	.uleb128 .LEHE16-.LEHB16
-	.uleb128 .L174-.LFB3557
+	.uleb128 .LEHB59-.LFB12690
+	.uleb128 .LEHE59-.LEHB59
+	.uleb128 .L1315-.LFB12690
 	.uleb128 0
-	.uleb128 .LEHB17-.LFB3557
-	.uleb128 .LEHE17-.LEHB17
-	.uleb128 .L175-.LFB3557
+	.uleb128 .LEHB60-.LFB12690
+	.uleb128 .LEHE60-.LEHB60
+	.uleb128 .L1335-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB61-.LFB12690
+	.uleb128 .LEHE61-.LEHB61
+	.uleb128 .L1329-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB62-.LFB12690
+	.uleb128 .LEHE62-.LEHB62
+	.uleb128 .L1338-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB63-.LFB12690
+	.uleb128 .LEHE63-.LEHB63
+	.uleb128 .L1331-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB64-.LFB12690
+	.uleb128 .LEHE64-.LEHB64
+	.uleb128 .L1333-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB65-.LFB12690
+	.uleb128 .LEHE65-.LEHB65
+	.uleb128 .L1340-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB66-.LFB12690
+	.uleb128 .LEHE66-.LEHB66
+	.uleb128 .L1336-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB67-.LFB12690
+	.uleb128 .LEHE67-.LEHB67
+	.uleb128 .L1340-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB68-.LFB12690
+	.uleb128 .LEHE68-.LEHB68
+	.uleb128 .L1331-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB69-.LFB12690
+	.uleb128 .LEHE69-.LEHB69
+	.uleb128 .L1340-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB70-.LFB12690
+	.uleb128 .LEHE70-.LEHB70
+	.uleb128 .L1316-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB71-.LFB12690
+	.uleb128 .LEHE71-.LEHB71
+	.uleb128 .L1318-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB72-.LFB12690
+	.uleb128 .LEHE72-.LEHB72
+	.uleb128 .L1317-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB73-.LFB12690
+	.uleb128 .LEHE73-.LEHB73
+	.uleb128 .L1339-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB74-.LFB12690
+	.uleb128 .LEHE74-.LEHB74
+	.uleb128 .L1318-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB75-.LFB12690
+	.uleb128 .LEHE75-.LEHB75
+	.uleb128 .L1339-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB76-.LFB12690
+	.uleb128 .LEHE76-.LEHB76
+	.uleb128 .L1318-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB77-.LFB12690
+	.uleb128 .LEHE77-.LEHB77
+	.uleb128 .L1316-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB78-.LFB12690
+	.uleb128 .LEHE78-.LEHB78
+	.uleb128 .L1333-.LFB12690
+	.uleb128 0x1
+	.uleb128 .LEHB79-.LFB12690
+	.uleb128 .LEHE79-.LEHB79
+	.uleb128 .L1315-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB80-.LFB12690
+	.uleb128 .LEHE80-.LEHB80
+	.uleb128 .L1335-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB81-.LFB12690
+	.uleb128 .LEHE81-.LEHB81
+	.uleb128 .L1319-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB82-.LFB12690
+	.uleb128 .LEHE82-.LEHB82
+	.uleb128 .L1320-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB83-.LFB12690
+	.uleb128 .LEHE83-.LEHB83
+	.uleb128 .L1337-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB84-.LFB12690
+	.uleb128 .LEHE84-.LEHB84
+	.uleb128 .L1343-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB85-.LFB12690
+	.uleb128 .LEHE85-.LEHB85
+	.uleb128 .L1342-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB86-.LFB12690
+	.uleb128 .LEHE86-.LEHB86
+	.uleb128 .L1341-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB87-.LFB12690
+	.uleb128 .LEHE87-.LEHB87
+	.uleb128 .L1321-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB88-.LFB12690
+	.uleb128 .LEHE88-.LEHB88
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB89-.LFB12690
+	.uleb128 .LEHE89-.LEHB89
+	.uleb128 .L1323-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB90-.LFB12690
+	.uleb128 .LEHE90-.LEHB90
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB91-.LFB12690
+	.uleb128 .LEHE91-.LEHB91
+	.uleb128 .L1324-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB92-.LFB12690
+	.uleb128 .LEHE92-.LEHB92
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB93-.LFB12690
+	.uleb128 .LEHE93-.LEHB93
+	.uleb128 .L1325-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB94-.LFB12690
+	.uleb128 .LEHE94-.LEHB94
+	.uleb128 .L1326-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB95-.LFB12690
+	.uleb128 .LEHE95-.LEHB95
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB96-.LFB12690
+	.uleb128 .LEHE96-.LEHB96
+	.uleb128 .L1319-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB97-.LFB12690
+	.uleb128 .LEHE97-.LEHB97
+	.uleb128 .L1320-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB98-.LFB12690
+	.uleb128 .LEHE98-.LEHB98
+	.uleb128 .L1324-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB99-.LFB12690
+	.uleb128 .LEHE99-.LEHB99
+	.uleb128 .L1323-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB100-.LFB12690
+	.uleb128 .LEHE100-.LEHB100
+	.uleb128 .L1327-.LFB12690
 	.uleb128 0
-.LLSDACSE3557:
+	.uleb128 .LEHB101-.LFB12690
+	.uleb128 .LEHE101-.LEHB101
+	.uleb128 .L1325-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB102-.LFB12690
+	.uleb128 .LEHE102-.LEHB102
+	.uleb128 .L1326-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB103-.LFB12690
+	.uleb128 .LEHE103-.LEHB103
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB104-.LFB12690
+	.uleb128 .LEHE104-.LEHB104
+	.uleb128 .L1327-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB105-.LFB12690
+	.uleb128 .LEHE105-.LEHB105
+	.uleb128 .L1319-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB106-.LFB12690
+	.uleb128 .LEHE106-.LEHB106
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB107-.LFB12690
+	.uleb128 .LEHE107-.LEHB107
+	.uleb128 .L1334-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB108-.LFB12690
+	.uleb128 .LEHE108-.LEHB108
+	.uleb128 .L1319-.LFB12690
+	.uleb128 0
+	.uleb128 .LEHB109-.LFB12690
+	.uleb128 .LEHE109-.LEHB109
+	.uleb128 .L1322-.LFB12690
+	.uleb128 0
+.LLSDACSE12690:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATT12690:
 	.section	.text.startup
 	.cfi_endproc
 	.section	.text.unlikely
 	.cfi_startproc
-	.cfi_personality 0x3,__gxx_personality_v0
-	.cfi_lsda 0x3,.LLSDAC3557
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDAC12690
 	.type	main.cold, @function
 main.cold:
-.LFSB3557:
-.L164:
-	.cfi_def_cfa_offset 10192
+.LFSB12690:
+.L1192:
+	.cfi_def_cfa_offset 10768
 	.cfi_offset 3, -56
 	.cfi_offset 6, -48
 	.cfi_offset 12, -40
 	.cfi_offset 13, -32
 	.cfi_offset 14, -24
 	.cfi_offset 15, -16
-	testq	%rbp, %rbp
-	jne	.L220
-.L163:
-	movq	40(%rsp), %rdi
+	leaq	_ZGVZ6perfitRKSt8functionIFvvEEE8counters(%rip), %rdi
+	call	__cxa_guard_abort@PLT
+.L1193:
+	movq	368(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L1569
+.L1256:
+	movq	80(%rsp), %rdi
+	call	_ZNSt6vectorISt4pairINSt7__cxx1112basic_stringIcSt11char_traitsIcESaIcEEEPFvPciEESaISA_EED1Ev
+.L1253:
+	movq	288(%rsp), %rdi
+	movq	304(%rsp), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	jne	.L1570
+.L1265:
+	movq	64(%rsp), %rdi
 	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
-.L166:
-	leaq	112(%rsp), %rdi
-	call	_ZNSt13random_device7_M_finiEv
+.L1266:
+	movq	32(%rsp), %rdi
+	call	_ZN10StringPoolD1Ev
+.L1243:
+	movq	88(%rsp), %rdi
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
+.L1239:
 	movq	%rbx, %rdi
-.LEHB18:
-	call	_Unwind_Resume
-.LEHE18:
-.L161:
-	movq	80(%rsp), %rdi
-	movq	96(%rsp), %rsi
+	call	_ZNSt6vectorIS_IcSaIcEESaIS1_EED1Ev
+.L1267:
+	movq	56(%rsp), %rdi
+	call	_ZNSt13random_device7_M_finiEv@PLT
+	movq	%rbp, %rdi
+.LEHB110:
+	call	_Unwind_Resume@PLT
+.LEHE110:
+.L1569:
+	leaq	352(%rsp), %rdi
+	movl	$3, %edx
+	movq	%rdi, %rsi
+	call	*%rax
+	jmp	.L1256
+.L1570:
+	call	_ZdlPvm@PLT
+	jmp	.L1265
+.L1148:
+	movq	56(%rsp), %r13
+.L1149:
+	subq	$40, %r13
+	movq	0(%r13), %rdi
+	leaq	16(%r13), %rax
+	cmpq	%rax, %rdi
+	jne	.L1571
+.L1249:
+	cmpq	%r12, %r13
+	jne	.L1149
+.L1512:
+	movl	$3, %eax
+.L1140:
+	movl	$3, %r13d
+	subq	%rax, %r13
+	imulq	$40, %r13, %r13
+	addq	%r12, %r13
+.L1252:
+	cmpq	%r12, %r13
+	je	.L1253
+	subq	$40, %r13
+	movq	0(%r13), %rdi
+	leaq	16(%r13), %rax
+	cmpq	%rax, %rdi
+	je	.L1252
+	movq	16(%r13), %rax
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1252
+.L1144:
+	movl	$1, %eax
+	jmp	.L1140
+.L1146:
+	xorl	%eax, %eax
+	jmp	.L1140
+.L1142:
+	movl	$2, %eax
+	jmp	.L1140
+.L1571:
+	movq	16(%r13), %rax
+	leaq	1(%rax), %rsi
+	call	_ZdlPvm@PLT
+	jmp	.L1249
+.L1261:
+	movq	544(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1256
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+	jmp	.L1256
+.L1257:
+	movq	544(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1256
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+	jmp	.L1256
+.L1259:
+	movq	544(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1256
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+	jmp	.L1256
+.L1254:
+	movq	544(%rsp), %rax
+	testq	%rax, %rax
+	je	.L1256
+	movl	$3, %edx
+	movq	%r12, %rsi
+	movq	%r12, %rdi
+	call	*%rax
+	jmp	.L1256
+.L1244:
+	testq	%r12, %r12
+	je	.L1245
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	call	_ZdlPvm@PLT
+.L1245:
+	testq	%r15, %r15
+	je	.L1248
+.L1247:
+	movq	48(%rsp), %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.L1248:
+	movq	40(%rsp), %rdi
+	call	_ZNSt6vectorI12AsciiKernelsSaIS0_EED1Ev
+	jmp	.L1243
+.L1006:
+	call	__cxa_begin_catch@PLT
+	cmpq	$0, 32(%rsp)
+	jne	.L1007
+	movq	(%r12), %rdi
+	movq	16(%r12), %rsi
 	subq	%rdi, %rsi
 	testq	%rdi, %rdi
-	je	.L163
-	call	_ZdlPvm
-	jmp	.L163
-.L220:
+	je	.L1009
+.L1509:
+	call	_ZdlPvm@PLT
+.L1009:
+.LEHB111:
+	call	__cxa_rethrow@PLT
+.LEHE111:
+.L1328:
+	movq	%rax, %rbp
+	call	__cxa_end_catch@PLT
+.L1011:
+	movq	(%rsp), %rsi
+	movq	24(%rsp), %rax
+	subq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L1238
+	movq	%rax, %rdi
+	call	_ZdlPvm@PLT
+.L1238:
+	leaq	192(%rsp), %rbx
+	jmp	.L1239
+.L1007:
+	movq	32(%rsp), %rbx
+	movq	%rbx, %rsi
+	movq	%rbx, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+	movq	40(%rsp), %rsi
+	movq	%rbx, %rdi
+	jmp	.L1509
+.L1268:
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.L1242:
 	movq	%r12, %rsi
 	movq	%rbp, %rdi
-	call	_ZdlPvm
-	jmp	.L163
+	call	_ZdlPvm@PLT
+.L1241:
+	movq	%r13, %rbp
+	jmp	.L1243
+.L1039:
+	call	__cxa_begin_catch@PLT
+	cmpq	$0, (%rsp)
+	jne	.L1040
+	movq	0(%r13), %rdi
+	movq	16(%r13), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L1042
+.L1510:
+	call	_ZdlPvm@PLT
+.L1042:
+.LEHB112:
+	call	__cxa_rethrow@PLT
+.LEHE112:
+.L1062:
+	call	__cxa_begin_catch@PLT
+	cmpq	$0, (%rsp)
+	jne	.L1063
+	movq	0(%r13), %rdi
+	movq	16(%r13), %rsi
+	subq	%rdi, %rsi
+	testq	%rdi, %rdi
+	je	.L1065
+.L1511:
+	call	_ZdlPvm@PLT
+.L1065:
+.LEHB113:
+	call	__cxa_rethrow@PLT
+.LEHE113:
+.L1040:
+	movq	(%rsp), %r14
+	movq	%r14, %rsi
+	movq	%r14, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+	imulq	$24, 24(%rsp), %rsi
+	movq	%r14, %rdi
+	jmp	.L1510
+.L1063:
+	movq	(%rsp), %r14
+	movq	%r14, %rsi
+	movq	%r14, %rdi
+	call	_ZNSt12_Destroy_auxILb0EE9__destroyIPSt6vectorIcSaIcEEEEvT_S6_
+	imulq	$24, 32(%rsp), %rsi
+	movq	%r14, %rdi
+	jmp	.L1511
+.L1330:
+	movq	%rax, %r13
+	call	__cxa_end_catch@PLT
+.L1044:
+	testq	%r15, %r15
+	je	.L1240
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	_ZdlPvm@PLT
+.L1240:
+	testq	%rbp, %rbp
+	je	.L1241
+	jmp	.L1242
+.L1332:
+	movq	%rax, %r13
+	call	__cxa_end_catch@PLT
+	jmp	.L1044
 	.cfi_endproc
-.LFE3557:
+.LFE12690:
 	.section	.gcc_except_table
-.LLSDAC3557:
-	.byte	0xff
+	.align 4
+.LLSDAC12690:
 	.byte	0xff
+	.byte	0x9b
+	.uleb128 .LLSDATTC12690-.LLSDATTDC12690
+.LLSDATTDC12690:
 	.byte	0x1
-	.uleb128 .LLSDACSEC3557-.LLSDACSBC3557
-.LLSDACSBC3557:
-	.uleb128 .LEHB18-.LCOLDB7
-	.uleb128 .LEHE18-.LEHB18
+	.uleb128 .LLSDACSEC12690-.LLSDACSBC12690
+.LLSDACSBC12690:
+	.uleb128 .LEHB110-.LCOLDB86
+	.uleb128 .LEHE110-.LEHB110
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LEHB111-.LCOLDB86
+	.uleb128 .LEHE111-.LEHB111
+	.uleb128 .L1328-.LCOLDB86
 	.uleb128 0
+	.uleb128 .LEHB112-.LCOLDB86
+	.uleb128 .LEHE112-.LEHB112
+	.uleb128 .L1330-.LCOLDB86
 	.uleb128 0
-.LLSDACSEC3557:
+	.uleb128 .LEHB113-.LCOLDB86
+	.uleb128 .LEHE113-.LEHB113
+	.uleb128 .L1332-.LCOLDB86
+	.uleb128 0
+.LLSDACSEC12690:
+	.byte	0x1
+	.byte	0
+	.align 4
+	.long	0
+
+.LLSDATTC12690:
 	.section	.text.unlikely
 	.section	.text.startup
 	.size	main, .-main
 	.section	.text.unlikely
 	.size	main.cold, .-main.cold
-.LCOLDE7:
+.LCOLDE86:
 	.section	.text.startup
-.LHOTE7:
+.LHOTE86:
 	.p2align 4
 	.type	_GLOBAL__sub_I__Z16toupper_standardPci, @function
 _GLOBAL__sub_I__Z16toupper_standardPci:
-.LFB4491:
+.LFB14787:
 	.cfi_startproc
-	subq	$8, %rsp
+	pushq	%r12
 	.cfi_def_cfa_offset 16
-	movl	$_ZStL8__ioinit, %edi
-	call	_ZNSt8ios_base4InitC1Ev
-	movl	$__dso_handle, %edx
-	movl	$_ZStL8__ioinit, %esi
-	movl	$_ZNSt8ios_base4InitD1Ev, %edi
-	addq	$8, %rsp
+	.cfi_offset 12, -16
+	leaq	_ZL5ascii(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	_ZStL8__ioinit(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rbp, %rdi
+	leaq	__dso_handle(%rip), %rbx
+	call	_ZNSt8ios_base4InitC1Ev@PLT
+	movq	_ZNSt8ios_base4InitD1Ev@GOTPCREL(%rip), %rdi
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	leaq	_ZN12AsciiKernelsD1Ev(%rip), %rbp
+	call	__cxa_atexit@PLT
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	leaq	_ZL14scalar_kernels(%rip), %rsi
+	call	__cxa_atexit@PLT
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	leaq	_ZL12sse2_kernels(%rip), %rsi
+	call	__cxa_atexit@PLT
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	leaq	_ZL12avx2_kernels(%rip), %rsi
+	call	__cxa_atexit@PLT
+	movq	%rbx, %rdx
+	leaq	_ZL14avx512_kernels(%rip), %rsi
+	movq	%rbp, %rdi
+	call	__cxa_atexit@PLT
+	movq	%r12, %rdi
+	call	_Z14select_kernelsv
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
 	.cfi_def_cfa_offset 8
-	jmp	__cxa_atexit
+	jmp	__cxa_atexit@PLT
 	.cfi_endproc
-.LFE4491:
+.LFE14787:
 	.size	_GLOBAL__sub_I__Z16toupper_standardPci, .-_GLOBAL__sub_I__Z16toupper_standardPci
 	.section	.init_array,"aw"
 	.align 8
 	.quad	_GLOBAL__sub_I__Z16toupper_standardPci
+	.section	.data.rel.ro,"aw"
+	.align 8
+	.type	_ZTIZ4mainEUlvE0_, @object
+	.size	_ZTIZ4mainEUlvE0_, 16
+_ZTIZ4mainEUlvE0_:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSZ4mainEUlvE0_
 	.section	.rodata
-	.align 16
-	.type	C.1.0, @object
-	.size	C.1.0, 16
-C.1.0:
-	.quad	_Z18toupper_branchlessPci
-	.quad	_Z16toupper_standardPci
+	.align 8
+	.type	_ZTSZ4mainEUlvE0_, @object
+	.size	_ZTSZ4mainEUlvE0_, 15
+_ZTSZ4mainEUlvE0_:
+	.string	"*Z4mainEUlvE0_"
+	.section	.data.rel.ro
+	.align 8
+	.type	_ZTIZ4mainEUlvE1_, @object
+	.size	_ZTIZ4mainEUlvE1_, 16
+_ZTIZ4mainEUlvE1_:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSZ4mainEUlvE1_
+	.section	.rodata
+	.align 8
+	.type	_ZTSZ4mainEUlvE1_, @object
+	.size	_ZTSZ4mainEUlvE1_, 15
+_ZTSZ4mainEUlvE1_:
+	.string	"*Z4mainEUlvE1_"
+	.section	.data.rel.ro
+	.align 8
+	.type	_ZTIZ4mainEUlvE2_, @object
+	.size	_ZTIZ4mainEUlvE2_, 16
+_ZTIZ4mainEUlvE2_:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSZ4mainEUlvE2_
+	.section	.rodata
+	.align 8
+	.type	_ZTSZ4mainEUlvE2_, @object
+	.size	_ZTSZ4mainEUlvE2_, 15
+_ZTSZ4mainEUlvE2_:
+	.string	"*Z4mainEUlvE2_"
+	.section	.data.rel.ro
+	.align 8
+	.type	_ZTIZ4mainEUlvE3_, @object
+	.size	_ZTIZ4mainEUlvE3_, 16
+_ZTIZ4mainEUlvE3_:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSZ4mainEUlvE3_
+	.section	.rodata
+	.align 8
+	.type	_ZTSZ4mainEUlvE3_, @object
+	.size	_ZTSZ4mainEUlvE3_, 15
+_ZTSZ4mainEUlvE3_:
+	.string	"*Z4mainEUlvE3_"
+	.section	.data.rel.ro
+	.align 8
+	.type	_ZTIZ4mainEUlvE4_, @object
+	.size	_ZTIZ4mainEUlvE4_, 16
+_ZTIZ4mainEUlvE4_:
+	.quad	_ZTVN10__cxxabiv117__class_type_infoE+16
+	.quad	_ZTSZ4mainEUlvE4_
+	.section	.rodata
+	.align 8
+	.type	_ZTSZ4mainEUlvE4_, @object
+	.size	_ZTSZ4mainEUlvE4_, 15
+_ZTSZ4mainEUlvE4_:
+	.string	"*Z4mainEUlvE4_"
 	.align 32
 	.type	_ZL8alphanum, @object
 	.size	_ZL8alphanum, 63
 _ZL8alphanum:
 	.string	"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+	.local	_ZL5ascii
+	.comm	_ZL5ascii,56,32
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	_ZL14avx512_kernels, @object
+	.size	_ZL14avx512_kernels, 56
+_ZL14avx512_kernels:
+	.quad	_ZL14avx512_kernels+16
+	.quad	6
+	.byte	97
+	.byte	118
+	.byte	120
+	.byte	53
+	.byte	49
+	.byte	50
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.quad	_Z18shift_range_avx512ILc97ELc122ELc32EEvPci
+	.quad	_Z18shift_range_avx512ILc65ELc90ELcn32EEvPci
+	.quad	_Z16all_alnum_avx512PKci
+	.align 32
+	.type	_ZL12avx2_kernels, @object
+	.size	_ZL12avx2_kernels, 56
+_ZL12avx2_kernels:
+	.quad	_ZL12avx2_kernels+16
+	.quad	4
+	.byte	97
+	.byte	118
+	.byte	120
+	.byte	50
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.quad	_Z16shift_range_avx2ILc97ELc122ELc32EEvPci
+	.quad	_Z16shift_range_avx2ILc65ELc90ELcn32EEvPci
+	.quad	_Z14all_alnum_avx2PKci
+	.align 32
+	.type	_ZL12sse2_kernels, @object
+	.size	_ZL12sse2_kernels, 56
+_ZL12sse2_kernels:
+	.quad	_ZL12sse2_kernels+16
+	.quad	4
+	.byte	115
+	.byte	115
+	.byte	101
+	.byte	50
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.quad	_Z16shift_range_sse2ILc97ELc122ELc32EEvPci
+	.quad	_Z16shift_range_sse2ILc65ELc90ELcn32EEvPci
+	.quad	_Z14all_alnum_sse2PKci
+	.align 32
+	.type	_ZL14scalar_kernels, @object
+	.size	_ZL14scalar_kernels, 56
+_ZL14scalar_kernels:
+	.quad	_ZL14scalar_kernels+16
+	.quad	6
+	.byte	115
+	.byte	99
+	.byte	97
+	.byte	108
+	.byte	97
+	.byte	114
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.quad	_Z18shift_range_scalarILc97ELc122ELc32EEvPci
+	.quad	_Z18shift_range_scalarILc65ELc90ELcn32EEvPci
+	.quad	_Z16all_alnum_scalarPKci
+	.weak	_ZGVZ6perfitRKSt8functionIFvvEEE8counters
+	.section	.bss._ZGVZ6perfitRKSt8functionIFvvEEE8counters,"awG",@nobits,_ZGVZ6perfitRKSt8functionIFvvEEE8counters,comdat
+	.align 8
+	.type	_ZGVZ6perfitRKSt8functionIFvvEEE8counters, @gnu_unique_object
+	.size	_ZGVZ6perfitRKSt8functionIFvvEEE8counters, 8
+_ZGVZ6perfitRKSt8functionIFvvEEE8counters:
+	.zero	8
+	.weak	_ZZ6perfitRKSt8functionIFvvEEE8counters
+	.section	.bss._ZZ6perfitRKSt8functionIFvvEEE8counters,"awG",@nobits,_ZZ6perfitRKSt8functionIFvvEEE8counters,comdat
+	.align 32
+	.type	_ZZ6perfitRKSt8functionIFvvEEE8counters, @gnu_unique_object
+	.size	_ZZ6perfitRKSt8functionIFvvEEE8counters, 56
+_ZZ6perfitRKSt8functionIFvvEEE8counters:
+	.zero	56
 	.local	_ZStL8__ioinit
 	.comm	_ZStL8__ioinit,1,1
 	.section	.rodata.cst16,"aM",@progbits,16
@@ -1740,6 +10182,200 @@ _ZL8alphanum:
 	.byte	32
 	.byte	32
 	.byte	32
+	.align 16
+.LC3:
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.byte	-65
+	.set	.LC4,.LC3
+	.set	.LC5,.LC1
+	.set	.LC6,.LC2
+	.set	.LC7,.LC2
+	.align 16
+.LC8:
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.align 16
+.LC9:
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.byte	-102
+	.align 16
+.LC10:
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.byte	80
+	.align 16
+.LC11:
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.byte	-118
+	.set	.LC25,.LC3
+	.set	.LC26,.LC1
+	.set	.LC27,.LC2
+	.align 16
+.LC28:
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.byte	63
+	.align 16
+.LC29:
+	.quad	-2242545357980376864
+	.quad	-2242545357980376864
+	.align 16
+.LC40:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.align 16
+.LC44:
+	.long	16
+	.long	16
+	.long	16
+	.long	16
+	.align 16
+.LC45:
+	.long	4
+	.long	4
+	.long	4
+	.long	4
+	.align 16
+.LC46:
+	.long	8
+	.long	8
+	.long	8
+	.long	8
+	.align 16
+.LC47:
+	.long	12
+	.long	12
+	.long	12
+	.long	12
+	.align 16
+.LC48:
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.value	255
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC49:
+	.long	2
+	.long	2
+	.set	.LC50,.LC45
+	.align 8
+.LC51:
+	.long	6
+	.long	6
+	.set	.LC52,.LC48
+	.align 8
+.LC65:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC66:
+	.long	0
+	.long	1138753536
+	.align 8
+.LC75:
+	.long	0
+	.long	1079574528
+	.section	.data.rel.ro.local,"aw"
+	.align 8
+.LC85:
+	.quad	_ZNSt17_Function_handlerIFvvEZ4mainEUlvE1_E9_M_invokeERKSt9_Any_data
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
 	.hidden	__dso_handle
-	.ident	"GCC: (mk-2022.0) 11.2.0"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
 	.section	.note.GNU-stack,"",@progbits
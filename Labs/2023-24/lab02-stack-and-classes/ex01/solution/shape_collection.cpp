@@ -0,0 +1,77 @@
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cmath>
+#include <iostream>
+
+#include "shapes.hpp"
+#include "shape_collection.hpp"
+
+// total area and all the areas of the same random shapes stored as
+// std::vector<std::shared_ptr<Shape>> and as ShapeCollection; the number of shapes is
+// given as first argument
+int main(int argc, char* argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 10000000;
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<double> size_distrib(0.1, 2.0);
+    std::bernoulli_distribution is_circle(0.5);
+
+    std::vector<std::shared_ptr<Shape>> shapes;
+    shapes.reserve(n);
+    ShapeCollection collection;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (is_circle(engine)) {
+            const Circle c(size_distrib(engine));
+            shapes.push_back(std::make_shared<Circle>(c));
+            collection.add(c);
+        } else {
+            const double b = size_distrib(engine), h = size_distrib(engine);
+            shapes.push_back(std::make_shared<Rectangle>(b, h));
+            collection.emplace<Rectangle>(b, h);
+        }
+    }
+
+    using namespace std::chrono;
+    // total area
+    auto t0 = high_resolution_clock::now();
+    double total_ptr = 0.0;
+    for (const auto& s : shapes)
+        total_ptr += s->getArea();
+    auto t1 = high_resolution_clock::now();
+    const auto dt_ptr = duration_cast<microseconds>(t1 - t0).count();
+
+    t0 = high_resolution_clock::now();
+    const double total = collection.total_area();
+    t1 = high_resolution_clock::now();
+    const auto dt_soa = duration_cast<microseconds>(t1 - t0).count();
+    std::cout << "total area of " << n << " shapes: shared_ptr " << dt_ptr / 1000.0 << " [ms], ShapeCollection "
+        << dt_soa / 1000.0 << " [ms], speedup " << double(dt_ptr) / dt_soa << std::endl;
+    std::cout << "same total area: " << (std::abs(total - total_ptr) <= 1e-12 * total ? "PASSED" : "FAILED") << std::endl;
+
+    // all the areas
+    std::vector<double> areas_ptr(n), areas(n);
+    t0 = high_resolution_clock::now();
+    for (std::size_t i = 0; i < n; ++i)
+        areas_ptr[i] = shapes[i]->getArea();
+    t1 = high_resolution_clock::now();
+    const auto dt_ptr_all = duration_cast<microseconds>(t1 - t0).count();
+
+    t0 = high_resolution_clock::now();
+    collection.areas(areas);
+    t1 = high_resolution_clock::now();
+    const auto dt_soa_all = duration_cast<microseconds>(t1 - t0).count();
+    std::cout << "all the areas: shared_ptr " << dt_ptr_all / 1000.0 << " [ms], ShapeCollection "
+        << dt_soa_all / 1000.0 << " [ms], speedup " << double(dt_ptr_all) / dt_soa_all << std::endl;
+
+    // the collection is ordered by type, the circles come first
+    bool same = true;
+    std::size_t next_circle = 0, next_rectangle = collection.n_circles();
+    for (std::size_t i = 0; i < n; ++i) {
+        const bool circle = dynamic_cast<const Circle*>(shapes[i].get()) != nullptr;
+        same = same && areas[circle ? next_circle++ : next_rectangle++] == areas_ptr[i];
+    }
+    std::cout << "same areas: " << (same ? "PASSED" : "FAILED") << std::endl;
+    return 0;
+}
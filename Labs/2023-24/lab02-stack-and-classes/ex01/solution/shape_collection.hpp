@@ -0,0 +1,78 @@
+#ifndef SHAPE_COLLECTION_H
+#define SHAPE_COLLECTION_H
+
+#include <array>
+#include <cstddef>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "shapes.hpp"
+
+// A set of shapes without virtual calls: the shapes are grouped by type and each group
+// is a structure of arrays (one vector per member), so the areas of a group are
+// computed by a loop over contiguous doubles that the compiler vectorizes.
+// The shapes are not kept in insertion order but by type: first all the circles and
+// then all the rectangles, in the order they were added.
+class ShapeCollection {
+public:
+    void add(const Circle& c) { m_radius.push_back(c.getRadius()); };
+    void add(const Rectangle& r) {
+        m_basis.push_back(r.getBasis());
+        m_height.push_back(r.getHeight());
+    };
+    // builds the shape with the constructor of S, e.g. emplace<Rectangle>(2.5, 0.2)
+    template<typename S, typename... Args>
+    void emplace(Args&&... args) { add(S(std::forward<Args>(args)...)); }
+
+    void reserve(std::size_t n_circles, std::size_t n_rectangles) {
+        m_radius.reserve(n_circles);
+        m_basis.reserve(n_rectangles);
+        m_height.reserve(n_rectangles);
+    };
+
+    std::size_t size() const { return n_circles() + n_rectangles(); };
+    std::size_t n_circles() const { return m_radius.size(); };
+    std::size_t n_rectangles() const { return m_basis.size(); };
+
+    double total_area() const {
+        const double* r = m_radius.data();
+        const double* b = m_basis.data();
+        const double* h = m_height.data();
+        return std::numbers::pi_v<double> * sum(n_circles(), [r](std::size_t i) { return r[i] * r[i]; })
+            + sum(n_rectangles(), [b, h](std::size_t i) { return b[i] * h[i]; });
+    };
+
+    // out[i] is the area of the i-th shape in the order of the collection, out must
+    // have size() elements
+    void areas(std::span<double> out) const {
+        const auto nc = n_circles();
+        for (std::size_t i = 0; i < nc; ++i)
+            out[i] = m_radius[i] * m_radius[i] * std::numbers::pi_v<double>;
+        for (std::size_t i = 0; i < n_rectangles(); ++i)
+            out[nc + i] = m_basis[i] * m_height[i];
+    };
+
+private:
+    // sum of f(0), ..., f(n - 1) with independent partial sums: a single accumulator
+    // is a dependency chain that the compiler cannot reorder without -ffast-math
+    template<typename F>
+    static double sum(std::size_t n, F f) {
+        constexpr std::size_t lanes = 8;
+        std::array<double, lanes> partial{};
+        std::size_t i = 0;
+        for (; i + lanes <= n; i += lanes)
+            for (std::size_t l = 0; l < lanes; ++l)
+                partial[l] += f(i + l);
+        for (; i < n; ++i)
+            partial[0] += f(i);
+        return std::accumulate(partial.begin(), partial.end(), 0.0);
+    }
+
+    std::vector<double> m_radius;
+    std::vector<double> m_basis, m_height;
+};
+
+#endif /* SHAPE_COLLECTION_H */
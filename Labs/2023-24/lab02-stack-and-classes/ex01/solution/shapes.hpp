@@ -0,0 +1,39 @@
+#ifndef SHAPES_H
+#define SHAPES_H
+
+#include <numbers>
+#include <string>
+
+class Shape {
+public:
+    Shape(const std::string& name) : m_name(name) {};
+    virtual double getArea() const = 0;
+    const std::string& getName() const { return m_name; };
+    // always make base classes' destructors virtual when they're meant to be manipulated polymorphically.
+    virtual ~Shape() = default;
+private:
+    const std::string m_name;
+};
+
+class Circle : public Shape {
+public:
+    Circle(double radius) : Shape("Circle"), m_radius(radius) {};
+    virtual double getArea() const override { return m_radius * m_radius * std::numbers::pi_v<double>; };
+    double getRadius() const { return m_radius; };
+    virtual ~Circle() override = default;
+private:
+    const double m_radius;
+};
+
+class Rectangle : public Shape {
+public:
+    Rectangle(double b, double h) : Shape("Rectangle"), m_basis(b), m_height(h) {};
+    virtual double getArea() const override { return m_basis * m_height; };
+    double getBasis() const { return m_basis; };
+    double getHeight() const { return m_height; };
+    virtual ~Rectangle() override = default;
+private:
+    const double m_basis, m_height;
+};
+
+#endif /* SHAPES_H */
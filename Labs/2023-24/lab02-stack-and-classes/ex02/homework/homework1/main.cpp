@@ -1,5 +1,7 @@
+#include <chrono>
 #include <limits>
 #include "newton.hpp"
+#include "newton_observers.hpp"
 
 int main() {
     auto f = [](auto x) { return x * x - 2.0; };
@@ -27,9 +29,40 @@ int main() {
 
     NewtonSolver solver(params); // define a NewtonSolver object with the parameters
 
-    solver.solve(1.0);
+    solver.solve(1.0, PrintObserver{}); // print every iteration
 
     std::cout << std::endl;
 
+    // the same iterations as CSV
+    {
+        CsvObserver csv(std::cout);
+        solver.solve(1.0, csv);
+    }
+    std::cout << std::endl;
+
+    // many solves without an observer and with the in-memory statistics
+    const unsigned int n_solves = 1000000;
+    using namespace std::chrono;
+    double sum = 0.0;
+    auto t0 = steady_clock::now();
+    for (unsigned int i = 0; i < n_solves; ++i) {
+        solver.solve(1.0 + i * 1e-6);
+        sum += solver.getResult();
+    }
+    auto t1 = steady_clock::now();
+    std::cout << "no observer:    " << duration_cast<milliseconds>(t1 - t0).count() << " [ms]" << std::endl;
+
+    StatsObserver stats;
+    t0 = steady_clock::now();
+    for (unsigned int i = 0; i < n_solves; ++i) {
+        solver.solve(1.0 + i * 1e-6, stats);
+        sum += solver.getResult();
+    }
+    t1 = steady_clock::now();
+    std::cout << "StatsObserver:  " << duration_cast<milliseconds>(t1 - t0).count() << " [ms]" << std::endl;
+    std::cout << "solves = " << stats.n_solves << ", mean iter = " << stats.mean_iter()
+              << ", mean iteration time = " << stats.mean_time().count() << " [ns]"
+              << ", last res = " << stats.last_res << " (checksum " << sum << ")" << std::endl;
+
     return 0;
 }
@@ -1,10 +1,12 @@
 #ifndef NEWTON_H
 #define NEWTON_H
 
+#include <chrono>
 #include <cmath>
 #include <functional>
 #include <iostream>
 // #include <limits>
+#include <type_traits>
 #include <vector>
 
 struct NewtonParams {
@@ -20,12 +22,37 @@ struct NewtonParams {
   unsigned int iter;
 }; // struct NewtonParams, defining the parameters of the NewtonSolver class
 
+struct NewtonIteration {
+  unsigned int             iter;
+  double                   x;    // the iterate after the step
+  double                   res;  // f(x) before the step
+  double                   dx;   // the step, the last one if res is below tolerance
+  std::chrono::nanoseconds time; // zero if the observer does not ask for it
+}; // struct NewtonIteration, what an observer receives at every iteration
+
+// the default observer, every call is inlined away
+struct NullObserver {
+  void operator()(const NewtonIteration&) const {}
+};
+
+// an observer that sets `static constexpr bool wants_time = true;` gets the time of
+// each iteration, the clock is not read otherwise
+template<typename Observer>
+constexpr bool observer_wants_time() {
+  if constexpr (requires { Observer::wants_time; })
+    return Observer::wants_time;
+  else
+    return false;
+}
+
 class NewtonSolver {
 
   public:
 
     NewtonSolver(const NewtonParams& params); 
-    void solve(const double& x_0); // this is not const because it modifies the object
+    // the observer is called at every iteration with a NewtonIteration, see newton_observers.hpp
+    template<typename Observer = NullObserver>
+    void solve(const double& x_0, Observer&& observer = Observer{}); // this is not const because it modifies the object
     double getResult() const; 
     double getStep() const;
     const std::vector<double>& getHistory() const; 
@@ -48,4 +75,41 @@ class NewtonSolver {
     unsigned int        _iter;
 };    
 
+template<typename Observer>
+void NewtonSolver::solve(const double& x_0, Observer&& observer) {
+    constexpr bool timed = observer_wants_time<std::remove_cvref_t<Observer>>();
+
+    _x_n.resize(1); // THIS IS FUNDAMENTAL
+    _x_n.reserve(_max_iter + 1);
+    _x_n[0] = x_0;
+
+    auto start = std::chrono::steady_clock::time_point{};
+    const auto notify = [&]() {
+        auto time = std::chrono::nanoseconds::zero();
+        if constexpr (timed)
+            time = std::chrono::steady_clock::now() - start;
+        observer(NewtonIteration{ _iter, _x_n.back(), _res, _dx, time });
+    };
+
+    for (_iter = 0; _iter < _max_iter; ++_iter) {
+        if constexpr (timed)
+            start = std::chrono::steady_clock::now();
+
+        _res = _fx(_x_n[_iter]);
+
+        if (std::abs(_res) < _tol_res) {
+            notify();
+            break;
+        }
+
+        _df_dx = _dfx(_x_n[_iter]);
+        _dx = _res / _df_dx;
+
+        _x_n.push_back(_x_n[_iter] - _dx);
+        notify();
+
+        if (std::abs(_dx) < _tol_dx) break;
+    }
+}
+
 #endif
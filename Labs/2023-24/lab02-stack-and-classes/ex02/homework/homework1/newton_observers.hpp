@@ -0,0 +1,95 @@
+#ifndef NEWTON_OBSERVERS_H
+#define NEWTON_OBSERVERS_H
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "newton.hpp"
+
+// prints every iteration, the output of the old NewtonSolver::solve
+struct PrintObserver {
+  void operator()(const NewtonIteration& it) const {
+    std::cout << std::endl;
+    std::cout << "=== Newton Method ===" << std::endl;
+    std::cout << "iter =    " << it.iter << std::endl;
+    std::cout << "res  =    " << it.res << std::endl;
+    std::cout << "dx   =    " << it.dx << std::endl;
+    std::cout << "x    =    " << it.x << std::endl;
+  }
+}; // struct PrintObserver
+
+// aggregates in memory over any number of solves, nothing is stored per iteration
+struct StatsObserver {
+  static constexpr bool wants_time = true;
+
+  unsigned int             n_solves = 0;
+  unsigned int             n_iter = 0;
+  std::chrono::nanoseconds total_time{ 0 };
+  std::chrono::nanoseconds max_time{ 0 };
+  double                   last_res = 0.0;
+  double                   last_dx = 0.0;
+
+  void operator()(const NewtonIteration& it) {
+    if (it.iter == 0)
+      ++n_solves;
+    ++n_iter;
+    total_time += it.time;
+    max_time = std::max(max_time, it.time);
+    last_res = it.res;
+    last_dx = it.dx;
+  }
+
+  double mean_iter() const { return n_solves ? double(n_iter) / n_solves : 0.0; }
+  std::chrono::nanoseconds mean_time() const { return n_iter ? total_time / n_iter : total_time; }
+}; // struct StatsObserver
+
+// one line "iter,x,res,dx,time_ns" per iteration, formatted with std::to_chars into a
+// buffer that is written to the stream only when it is full, on flush() and at the end
+class CsvObserver {
+  public:
+    static constexpr bool wants_time = true;
+
+    explicit CsvObserver(std::ostream& out, std::size_t buffer_size = 1 << 16)
+        : _out(out), _buffer_size(buffer_size) {
+      _buffer.reserve(_buffer_size + line_size);
+      _buffer += "iter,x,res,dx,time_ns\n";
+    }
+    CsvObserver(const CsvObserver&) = delete;
+    CsvObserver& operator=(const CsvObserver&) = delete;
+    ~CsvObserver() { flush(); }
+
+    void operator()(const NewtonIteration& it) {
+      char line[line_size];
+      char* p = line;
+      const auto append = [&](auto v, char sep) {
+        p = std::to_chars(p, line + line_size, v).ptr;
+        *p++ = sep;
+      };
+      append(it.iter, ',');
+      append(it.x, ',');
+      append(it.res, ',');
+      append(it.dx, ',');
+      append(it.time.count(), '\n');
+      _buffer.append(line, p);
+      if (_buffer.size() >= _buffer_size)
+        flush();
+    }
+
+    void flush() {
+      _out.write(_buffer.data(), _buffer.size());
+      _buffer.clear();
+    }
+
+  private:
+    // enough for the shortest round trip representation of every field
+    static constexpr std::size_t line_size = 128;
+
+    std::ostream& _out;
+    std::size_t   _buffer_size;
+    std::string   _buffer;
+}; // class CsvObserver
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef BASIC_NEWTON_H
+#define BASIC_NEWTON_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "dual.hpp"
+
+// History policies: what BasicNewtonSolver remembers of the iterates x_0, x_1, ...
+
+// nothing, the solver never touches the heap
+struct NoHistory {
+  void reset(double, unsigned int) {}
+  void push(double) {}
+};
+
+// the last K iterates in a ring buffer, no heap either
+template<std::size_t K>
+class RingHistory {
+public:
+  void reset(double x0, unsigned int) {
+    m_count = 0;
+    push(x0);
+  }
+  void push(double x) { m_data[m_count++ % K] = x; }
+
+  // number of stored iterates
+  std::size_t size() const { return m_count < K ? m_count : K; }
+  // i-th iterate counting backwards, back(0) is the last one
+  double back(std::size_t i = 0) const { return m_data[(m_count - 1 - i) % K]; }
+
+private:
+  std::array<double, K> m_data{};
+  std::size_t m_count = 0;
+};
+
+// all the iterates, the memory is reserved at the first solve and then reused
+class FullHistory {
+public:
+  void reset(double x0, unsigned int n_max_it) {
+    m_x.resize(1);
+    m_x.reserve(n_max_it + 1);
+    m_x[0] = x0;
+  }
+  void push(double x) { m_x.push_back(x); }
+
+  const std::vector<double>& data() const { return m_x; }
+
+private:
+  std::vector<double> m_x;
+};
+
+// used as DFun, the derivative is computed by evaluating fun on dual numbers
+struct AutoDiff {};
+
+// Newton's method with the callables and the history as template parameters:
+// the calls to fun and dfun can be inlined and with NoHistory or RingHistory a
+// solve does not allocate. NewtonSolver is the version with std::function.
+template<typename Fun, typename DFun, typename History = NoHistory>
+class BasicNewtonSolver {
+public:
+  BasicNewtonSolver(
+    const Fun& fun_,
+    const DFun& dfun_,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon()
+  ) requires std::is_same_v<DFun, AutoDiff> || std::is_invocable_r_v<double, const DFun&, double>
+    :
+    m_fun(fun_),
+    m_dfun(dfun_),
+    m_n_max_it(n_max_it_),
+    m_tol_fun(tol_fun_),
+    m_tol_x(tol_x_),
+    m_x(0),
+    m_df_dx(0),
+    m_dx(0),
+    m_res(0),
+    m_iter(0) {
+  }
+
+  // only fun, f(x) and f'(x) come from a single evaluation of fun on Dual(x, 1)
+  BasicNewtonSolver(
+    const Fun& fun_,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon()
+  ) requires std::is_same_v<DFun, AutoDiff>
+    : BasicNewtonSolver(fun_, AutoDiff{}, n_max_it_, tol_fun_, tol_x_) {
+  }
+
+  void solve(const double x0) {
+    m_x = x0;
+    m_history.reset(x0, m_n_max_it);
+    for (m_iter = 0; m_iter < m_n_max_it; ++m_iter) {
+      if constexpr (std::is_same_v<DFun, AutoDiff>) {
+        const Dual f = m_fun(Dual(m_x, 1.0));
+        m_res = f.val;
+        m_df_dx = f.der;
+      }
+      else {
+        m_res = m_fun(m_x);
+      }
+
+      if (std::abs(m_res) < m_tol_fun)
+        break;
+
+      if constexpr (!std::is_same_v<DFun, AutoDiff>)
+        m_df_dx = m_dfun(m_x);
+
+      m_dx = -m_res / m_df_dx;
+      m_x += m_dx;
+      m_history.push(m_x);
+
+      if (std::abs(m_dx) < m_tol_x)
+        break;
+    }
+  }
+
+  double getResult() const {
+    return m_x;
+  };
+
+  double getStep() const {
+    return m_dx;
+  };
+
+  const History& getHistory() const {
+    return m_history;
+  }
+
+  double getResidual() const {
+    return m_res;
+  };
+
+  unsigned int getIter() const {
+    return m_iter;
+  };
+
+private:
+  Fun  m_fun;
+  DFun m_dfun;
+
+  const unsigned int m_n_max_it;
+  const double       m_tol_fun;
+  const double       m_tol_x;
+
+  History      m_history;
+  double       m_x;
+  double       m_df_dx;
+  double       m_dx;
+  double       m_res;
+  unsigned int m_iter;
+};
+
+template<typename Fun>
+BasicNewtonSolver(const Fun&) -> BasicNewtonSolver<Fun, AutoDiff>;
+template<typename Fun>
+BasicNewtonSolver(const Fun&, unsigned int, double = 0, double = 0) -> BasicNewtonSolver<Fun, AutoDiff>;
+
+#endif /* BASIC_NEWTON_H */
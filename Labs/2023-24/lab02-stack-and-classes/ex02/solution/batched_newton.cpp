@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "newton.hpp"
+#include "basic_newton.hpp"
+#include "batched_newton.hpp"
+
+// solves x^3 = a for many values of a with NewtonSolver and with BatchedNewtonSolver,
+// the number of equations is given as first argument
+int main(int argc, char* argv[]) {
+  const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<double> a_distrib(1.0, 1000.0), x0_distrib(0.5, 10.0);
+  std::vector<double> a(n), x0(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = a_distrib(engine);
+    x0[i] = x0_distrib(engine);
+  }
+  constexpr double tol = 1e-12;
+
+  using namespace std::chrono;
+  // the scalar solver reads the parameter of the current equation through the capture
+  double a_i = 0;
+  NewtonSolver solver([&a_i](double x) { return x * x * x - a_i; }, [](double x) { return 3.0 * x * x; }, 100, tol, tol);
+  std::vector<double> x_scalar(n);
+  std::vector<unsigned int> iter_scalar(n);
+  auto t0 = high_resolution_clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    a_i = a[i];
+    solver.solve(x0[i]);
+    x_scalar[i] = solver.getResult();
+    iter_scalar[i] = solver.getIter();
+  }
+  auto t1 = high_resolution_clock::now();
+  std::cout << "NewtonSolver:        " << duration_cast<milliseconds>(t1 - t0).count() << " [ms]" << std::endl;
+
+  // the same loop with the callables inlined and without history
+  BasicNewtonSolver basic([&a_i](double x) { return x * x * x - a_i; }, [](double x) { return 3.0 * x * x; }, 100, tol, tol);
+  bool same = true;
+  t0 = high_resolution_clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    a_i = a[i];
+    basic.solve(x0[i]);
+    same = same && basic.getResult() == x_scalar[i] && basic.getIter() == iter_scalar[i];
+  }
+  t1 = high_resolution_clock::now();
+  std::cout << "BasicNewtonSolver:   " << duration_cast<milliseconds>(t1 - t0).count() << " [ms], same results as NewtonSolver: "
+    << (same ? "PASSED" : "FAILED") << std::endl;
+
+  // f and f' from one evaluation on dual numbers, the derivative is exact so the
+  // iterates can differ from the hand written one only by rounding
+  BasicNewtonSolver autodiff([&a_i](auto x) { return x * x * x - a_i; }, 100, tol, tol);
+  double max_diff = 0;
+  t0 = high_resolution_clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    a_i = a[i];
+    autodiff.solve(x0[i]);
+    max_diff = std::max(max_diff, std::abs(autodiff.getResult() - x_scalar[i]) / x_scalar[i]);
+  }
+  t1 = high_resolution_clock::now();
+  std::cout << "BasicNewtonSolver with AutoDiff: " << duration_cast<milliseconds>(t1 - t0).count()
+    << " [ms], max relative difference " << max_diff << std::endl;
+
+  for (const unsigned int n_threads : { 1u, std::max(1u, std::thread::hardware_concurrency()) }) {
+    BatchedNewtonSolver batched([](auto x, auto p) { return x * x * x - p; }, [](auto x, auto) { return 3.0 * x * x; },
+      100, tol, tol, n_threads);
+    t0 = high_resolution_clock::now();
+    batched.solve(x0, a);
+    t1 = high_resolution_clock::now();
+    std::cout << "BatchedNewtonSolver: " << duration_cast<milliseconds>(t1 - t0).count() << " [ms] with "
+      << n_threads << " threads, " << stdx::native_simd<double>::size() << " lanes" << std::endl;
+
+    bool same = true;
+    unsigned int max_iter = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      same = same && x_scalar[i] == batched.getResult()[i] && iter_scalar[i] == batched.getIter()[i];
+      max_iter = std::max(max_iter, batched.getIter()[i]);
+    }
+    std::cout << "same results as NewtonSolver: " << (same ? "PASSED" : "FAILED")
+      << " (max iterations " << max_iter << ")" << std::endl;
+  }
+
+  // with no iterations allowed no step is taken, as in NewtonSolver
+  BatchedNewtonSolver no_steps([](auto x, auto p) { return x * x * x - p; }, [](auto x, auto) { return 3.0 * x * x; }, 0);
+  no_steps.solve(x0, a);
+  bool unchanged = true;
+  for (std::size_t i = 0; i < n; ++i)
+    unchanged = unchanged && no_steps.getResult()[i] == x0[i] && no_steps.getIter()[i] == 0;
+  std::cout << "no steps with n_max_it = 0: " << (unchanged ? "PASSED" : "FAILED") << std::endl;
+  return 0;
+}
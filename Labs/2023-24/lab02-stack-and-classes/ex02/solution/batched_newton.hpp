@@ -0,0 +1,165 @@
+#ifndef BATCHED_NEWTON_H
+#define BATCHED_NEWTON_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <experimental/simd>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace stdx = std::experimental;
+
+// Newton's method on many independent scalar equations at the same time, with the
+// same stopping criteria and results of NewtonSolver for each of them.
+// The data is stored as a structure of arrays (one vector per quantity) and each
+// SIMD register holds the iterates of different equations (lanes). fun and dfun are
+// called on stdx::native_simd<double>, so generic lambdas like
+// [](auto x) { return x * x - 2.0; } work as they are; for equations depending on a
+// parameter they are called as fun(x, p) with p taken from the vector of parameters.
+// When a lane converges its results are written back and the lane is refilled with
+// the next equation, so the registers stay full even if the number of iterations
+// differs a lot among the equations.
+template<typename Fun, typename DFun>
+class BatchedNewtonSolver {
+public:
+  using simd_t = stdx::native_simd<double>;
+
+  BatchedNewtonSolver(
+    const Fun& fun_,
+    const DFun& dfun_,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon(),
+    const unsigned int n_threads_ = std::max(1u, std::thread::hardware_concurrency())
+  )
+    :
+    m_fun(fun_),
+    m_dfun(dfun_),
+    m_n_max_it(n_max_it_),
+    m_tol_fun(tol_fun_),
+    m_tol_x(tol_x_),
+    m_n_threads(n_threads_) {
+  }
+
+  // solves fun(x) = 0, or fun(x, p[i]) = 0 for the i-th equation if p is not empty,
+  // starting from x0[i]
+  void solve(const std::vector<double>& x0, const std::vector<double>& p = {}) {
+    if (!p.empty() && p.size() != x0.size())
+      throw std::invalid_argument("BatchedNewtonSolver: x0 and p must have the same size");
+    const auto n = x0.size();
+    m_x.resize(n);
+    m_dx.resize(n);
+    m_res.resize(n);
+    m_iter.resize(n);
+    // each thread gets a contiguous part of the equations
+    std::vector<std::thread> threads;
+    const auto chunk = (n + m_n_threads - 1) / m_n_threads;
+    for (unsigned int t = 0; t < m_n_threads; ++t) {
+      const auto begin = std::min(n, t * chunk);
+      const auto end = std::min(n, begin + chunk);
+      if (begin < end)
+        threads.emplace_back([this, &x0, &p, begin, end]() { solve_range(x0, p, begin, end); });
+    }
+    for (auto& t : threads)
+      t.join();
+  }
+
+  const std::vector<double>& getResult() const { return m_x; }
+  const std::vector<double>& getStep() const { return m_dx; }
+  const std::vector<double>& getResidual() const { return m_res; }
+  const std::vector<unsigned int>& getIter() const { return m_iter; }
+
+private:
+  template<typename F>
+  static simd_t call(const F& f, const simd_t& x, const simd_t& p) {
+    if constexpr (std::is_invocable_v<const F&, simd_t, simd_t>)
+      return f(x, p);
+    else
+      return f(x);
+  }
+
+  void solve_range(const std::vector<double>& x0, const std::vector<double>& p, std::size_t begin, std::size_t end) {
+    constexpr auto W = simd_t::size();
+    // the state of the lanes lives in memory between the steps, so refilling a lane
+    // is a plain store and not an insertion into a register
+    alignas(stdx::memory_alignment_v<simd_t>) std::array<double, W> xs{}, dxs{}, its{}, ps{}, ress{};
+    // 1 in the lanes holding an equation, 0 in the empty ones
+    alignas(stdx::memory_alignment_v<simd_t>) std::array<double, W> lives{};
+    // the equation in each lane, end when the lane is empty
+    std::array<std::size_t, W> eq;
+    auto next = begin;
+    const auto fill = [&](std::size_t l) {
+      eq[l] = next < end ? next++ : end;
+      lives[l] = eq[l] != end;
+      if (eq[l] != end) {
+        xs[l] = x0[eq[l]];
+        ps[l] = p.empty() ? 0.0 : p[eq[l]];
+        dxs[l] = 0.0;
+        its[l] = 0.0;
+      }
+    };
+    for (std::size_t l = 0; l < W; ++l)
+      fill(l);
+    std::size_t active = std::count_if(eq.begin(), eq.end(), [end](auto e) { return e != end; });
+
+    while (active > 0) {
+      simd_t x(xs.data(), stdx::vector_aligned), dx(dxs.data(), stdx::vector_aligned);
+      simd_t it(its.data(), stdx::vector_aligned);
+      const simd_t par(ps.data(), stdx::vector_aligned);
+      // the empty lanes of the last batch are never updated and never count as done,
+      // otherwise they would end the loop below after every step
+      const auto live = simd_t(lives.data(), stdx::vector_aligned) != 0.0;
+      // Newton steps on every lane until one of them is done, the lanes that are done
+      // keep their values; like NewtonSolver a lane takes no step at the iteration limit,
+      // so with n_max_it = 0 the result is x0
+      simd_t res;
+      stdx::native_simd_mask<double> done;
+      do {
+        res = call(m_fun, x, par);
+        const auto small_res = abs(res) < m_tol_fun;
+        const simd_t step = -res / call(m_dfun, x, par);
+        const auto update = live && !small_res && it < double(m_n_max_it);
+        where(update, dx) = step;
+        where(update, x) = x + step;
+        const auto small_dx = update && abs(step) < m_tol_x;
+        where(update && !small_dx, it) = it + 1;
+        done = live && (small_res || small_dx || it >= double(m_n_max_it));
+      } while (none_of(done));
+      x.copy_to(xs.data(), stdx::vector_aligned);
+      dx.copy_to(dxs.data(), stdx::vector_aligned);
+      it.copy_to(its.data(), stdx::vector_aligned);
+      res.copy_to(ress.data(), stdx::vector_aligned);
+      // write back the lanes that are done and refill them
+      for (std::size_t l = 0; l < W; ++l) {
+        if (!done[l] || eq[l] == end)
+          continue;
+        m_x[eq[l]] = xs[l];
+        m_dx[eq[l]] = dxs[l];
+        m_res[eq[l]] = ress[l];
+        m_iter[eq[l]] = static_cast<unsigned int>(its[l]);
+        fill(l);
+        if (eq[l] == end)
+          --active;
+      }
+    }
+  }
+
+  Fun  m_fun;
+  DFun m_dfun;
+
+  const unsigned int m_n_max_it;
+  const double       m_tol_fun;
+  const double       m_tol_x;
+  const unsigned int m_n_threads;
+
+  std::vector<double>       m_x;
+  std::vector<double>       m_dx;
+  std::vector<double>       m_res;
+  std::vector<unsigned int> m_iter;
+};
+
+#endif /* BATCHED_NEWTON_H */
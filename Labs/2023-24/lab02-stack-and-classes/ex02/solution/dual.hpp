@@ -0,0 +1,41 @@
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <cmath>
+
+// Dual numbers a + b e with e^2 = 0 for forward mode automatic differentiation:
+// f(x + e) = f(x) + f'(x) e, so evaluating f on Dual(x, 1) gives f(x) and f'(x)
+// together. Functions written generically, like [](auto x) { return x * x - 2.0; },
+// work on Dual as they are; mathematical functions must be called unqualified
+// (sin(x), not std::sin(x)) so that the overloads below are found.
+struct Dual {
+  double val;
+  double der;
+
+  constexpr Dual(double val_ = 0, double der_ = 0) : val(val_), der(der_) {}
+
+  constexpr Dual& operator+=(const Dual& o) { val += o.val; der += o.der; return *this; }
+  constexpr Dual& operator-=(const Dual& o) { val -= o.val; der -= o.der; return *this; }
+  constexpr Dual& operator*=(const Dual& o) { der = der * o.val + val * o.der; val *= o.val; return *this; }
+  constexpr Dual& operator/=(const Dual& o) { der = (der * o.val - val * o.der) / (o.val * o.val); val /= o.val; return *this; }
+};
+
+// the doubles are converted to constants, Dual(c, 0)
+constexpr Dual operator+(Dual a, const Dual& b) { return a += b; }
+constexpr Dual operator-(Dual a, const Dual& b) { return a -= b; }
+constexpr Dual operator*(Dual a, const Dual& b) { return a *= b; }
+constexpr Dual operator/(Dual a, const Dual& b) { return a /= b; }
+constexpr Dual operator-(const Dual& a) { return { -a.val, -a.der }; }
+
+constexpr bool operator<(const Dual& a, const Dual& b) { return a.val < b.val; }
+constexpr bool operator>(const Dual& a, const Dual& b) { return a.val > b.val; }
+
+inline Dual sin(const Dual& a) { return { std::sin(a.val), a.der * std::cos(a.val) }; }
+inline Dual cos(const Dual& a) { return { std::cos(a.val), -a.der * std::sin(a.val) }; }
+inline Dual exp(const Dual& a) { const auto e = std::exp(a.val); return { e, a.der * e }; }
+inline Dual log(const Dual& a) { return { std::log(a.val), a.der / a.val }; }
+inline Dual sqrt(const Dual& a) { const auto s = std::sqrt(a.val); return { s, a.der / (2 * s) }; }
+inline Dual pow(const Dual& a, double p) { return { std::pow(a.val, p), a.der * p * std::pow(a.val, p - 1) }; }
+inline Dual abs(const Dual& a) { return a.val < 0 ? -a : a; }
+
+#endif /* DUAL_H */
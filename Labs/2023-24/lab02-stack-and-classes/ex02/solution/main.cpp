@@ -9,5 +9,11 @@ int main() {
   std::cout << "dx   =    " << solver.getStep() << std::endl;
   std::cout << "iter =    " << solver.getIter() << std::endl;
 
+  // the derivative is computed with dual numbers
+  NewtonSolver autodiff_solver([](auto x) { return x * x - 2.0; });
+  autodiff_solver.solve(1.0);
+  std::cout << "x    =    " << autodiff_solver.getResult() << " (automatic derivative)" << std::endl;
+  std::cout << "iter =    " << autodiff_solver.getIter() << std::endl;
+
   return 0;
 }
\ No newline at end of file
@@ -5,8 +5,18 @@
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
+#include "basic_newton.hpp"
+
+// the engines used by NewtonSolver, instantiated once in newton.cpp
+using FunctionNewtonSolver = BasicNewtonSolver<std::function<double(double)>, std::function<double(double)>, FullHistory>;
+using AutoDiffNewtonSolver = BasicNewtonSolver<std::function<Dual(Dual)>, AutoDiff, FullHistory>;
+extern template class BasicNewtonSolver<std::function<double(double)>, std::function<double(double)>, FullHistory>;
+extern template class BasicNewtonSolver<std::function<Dual(Dual)>, AutoDiff, FullHistory>;
+
 class NewtonSolver { 
 public:
   NewtonSolver(
@@ -17,53 +27,46 @@ public:
     const double tol_x_ = std::numeric_limits<double>::epsilon()
   )
     :
-    m_fun(fun_),
-    m_dfun(dfun_),
-    m_n_max_it(n_max_it_),
-    m_tol_fun(tol_fun_),
-    m_tol_x(tol_x_),
-    m_x(0),
-    m_df_dx(0),
-    m_dx(0),
-    m_res(0),
-    m_iter(0) {
+    m_solver(std::in_place_type<FunctionNewtonSolver>, fun_, dfun_, n_max_it_, tol_fun_, tol_x_) {
+  }
+
+  // without the derivative, fun must accept a Dual (e.g. a generic lambda)
+  template<typename Fun>
+    requires std::is_invocable_r_v<Dual, const Fun&, Dual>
+  NewtonSolver(
+    const Fun& fun_,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon()
+  )
+    :
+    m_solver(std::in_place_type<AutoDiffNewtonSolver>, fun_, n_max_it_, tol_fun_, tol_x_) {
   }
 
   void solve(const double x0);
 
   double getResult() const {
-    return m_x.back();
+    return std::visit([](const auto& s) { return s.getResult(); }, m_solver);
   };
 
   double getStep() const {
-    return m_dx;
+    return std::visit([](const auto& s) { return s.getStep(); }, m_solver);
   };
 
   const std::vector<double>& getHistory() const {
-    return m_x;
+    return std::visit([](const auto& s) -> const std::vector<double>& { return s.getHistory().data(); }, m_solver);
   }
 
   double getResidual() const {
-    return m_res;
+    return std::visit([](const auto& s) { return s.getResidual(); }, m_solver);
   };
 
   unsigned int getIter() const {
-    return m_iter;
+    return std::visit([](const auto& s) { return s.getIter(); }, m_solver);
   };
 
 private:
-  std::function<double(double)> m_fun;
-  std::function<double(double)> m_dfun;
-
-  const unsigned int m_n_max_it;
-  const double       m_tol_fun;
-  const double       m_tol_x;
-
-  std::vector<double> m_x;
-  double              m_df_dx;
-  double              m_dx;
-  double              m_res;
-  unsigned int        m_iter;
+  std::variant<FunctionNewtonSolver, AutoDiffNewtonSolver> m_solver;
 };
 
-#endif /* NEWTON_H */
\ No newline at end of file
+#endif /* NEWTON_H */
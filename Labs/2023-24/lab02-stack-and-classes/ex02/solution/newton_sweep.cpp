@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "newton_sweep.hpp"
+
+// solves Kepler's equation E - e sin(E) = M for the eccentric anomaly E on a grid of
+// mean anomalies M in [0, pi], with the three predictors; the number of parameters is
+// given as first argument
+int main(int argc, char* argv[]) {
+  const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 100000;
+  const double e = 0.9;
+  constexpr double tol = 1e-12;
+  std::vector<double> mean_anomaly(n);
+  for (std::size_t i = 0; i < n; ++i)
+    mean_anomaly[i] = std::numbers::pi * i / (n - 1);
+  // E = pi is the solution for M = pi and a safe starting point for the whole range
+  const double x0 = std::numbers::pi;
+
+  std::cout << std::setw(10) << "predictor" << std::setw(16) << "mean iter" << std::setw(10) << "max iter"
+    << std::setw(12) << "time [ms]" << std::endl;
+  std::vector<double> reference;
+  for (const auto& [name, predictor] : { std::make_pair("none", Predictor::none),
+                                         std::make_pair("constant", Predictor::constant),
+                                         std::make_pair("secant", Predictor::secant) }) {
+    NewtonSweep sweep([e](auto x, double m) { return x - e * sin(x) - m; }, predictor, 100, tol, tol);
+    using namespace std::chrono;
+    const auto t0 = high_resolution_clock::now();
+    sweep.solve(mean_anomaly, x0);
+    const auto t1 = high_resolution_clock::now();
+    const auto& iter = sweep.getIter();
+    std::cout << std::setw(10) << name << std::setw(16) << std::setprecision(3)
+      << std::accumulate(iter.begin(), iter.end(), 0.0) / n
+      << std::setw(10) << *std::max_element(iter.begin(), iter.end())
+      << std::setw(12) << duration_cast<microseconds>(t1 - t0).count() / 1000.0 << std::endl;
+
+    bool ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+      ok = ok && sweep.converged(i);
+    if (reference.empty())
+      reference = sweep.getResult();
+    for (std::size_t i = 0; i < n; ++i)
+      ok = ok && std::abs(sweep.getResult()[i] - reference[i]) < 1e-10;
+    std::cout << "converged to the same solutions: " << (ok ? "PASSED" : "FAILED") << std::endl;
+  }
+  return 0;
+}
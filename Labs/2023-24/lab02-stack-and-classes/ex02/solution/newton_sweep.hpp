@@ -0,0 +1,151 @@
+#ifndef NEWTON_SWEEP_H
+#define NEWTON_SWEEP_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "basic_newton.hpp"
+
+// how the starting point of a solve is chosen from the previous ones in a sweep
+enum class Predictor {
+  none,      // always the initial guess x0
+  constant,  // the last solution
+  secant     // the line through the last two solutions, evaluated at the new parameter
+};
+
+// Solves fun(x, p) = 0 for a sequence of parameters p_0, p_1, ... (natural parameter
+// continuation). The solutions x(p_i) are close to each other when the parameters are,
+// so each solve starts from a prediction based on the previous solutions instead of a
+// fixed guess: with the secant predictor the error of the starting point is
+// O(|p_i - p_(i-1)|^2) and a few Newton steps are enough.
+// The parameters are split in contiguous sub-sweeps solved in parallel, each one
+// starting from x0. Only the solves that converged are used for the predictions,
+// after a failure the sub-sweep restarts from x0.
+// With DFun = AutoDiff fun is called as fun(Dual, double), so it must be generic in x.
+template<typename Fun, typename DFun = AutoDiff>
+class NewtonSweep {
+public:
+  NewtonSweep(
+    const Fun& fun_,
+    const DFun& dfun_,
+    const Predictor predictor_ = Predictor::secant,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon(),
+    const unsigned int n_threads_ = std::max(1u, std::thread::hardware_concurrency())
+  )
+    :
+    m_fun(fun_),
+    m_dfun(dfun_),
+    m_predictor(predictor_),
+    m_n_max_it(n_max_it_),
+    m_tol_fun(tol_fun_),
+    m_tol_x(tol_x_),
+    m_n_threads(n_threads_) {
+  }
+
+  // only fun, the derivative comes from dual numbers
+  NewtonSweep(
+    const Fun& fun_,
+    const Predictor predictor_ = Predictor::secant,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = std::numeric_limits<double>::epsilon(),
+    const double tol_x_ = std::numeric_limits<double>::epsilon(),
+    const unsigned int n_threads_ = std::max(1u, std::thread::hardware_concurrency())
+  ) requires std::is_same_v<DFun, AutoDiff>
+    : NewtonSweep(fun_, AutoDiff{}, predictor_, n_max_it_, tol_fun_, tol_x_, n_threads_) {
+  }
+
+  void solve(const std::vector<double>& p, const double x0) {
+    const auto n = p.size();
+    m_x.resize(n);
+    m_res.resize(n);
+    m_iter.resize(n);
+    // the sub-sweeps must be long enough for the predictor to pay off
+    const auto n_chunks = std::max<std::size_t>(1, std::min<std::size_t>(m_n_threads, n / 64));
+    std::vector<std::thread> threads;
+    const auto chunk = (n + n_chunks - 1) / n_chunks;
+    for (std::size_t t = 0; t < n_chunks; ++t) {
+      const auto begin = std::min(n, t * chunk);
+      const auto end = std::min(n, begin + chunk);
+      if (begin < end)
+        threads.emplace_back([this, &p, x0, begin, end]() { solve_range(p, x0, begin, end); });
+    }
+    for (auto& t : threads)
+      t.join();
+  }
+
+  const std::vector<double>& getResult() const { return m_x; }
+  const std::vector<double>& getResidual() const { return m_res; }
+  const std::vector<unsigned int>& getIter() const { return m_iter; }
+  bool converged(std::size_t i) const { return m_iter[i] < m_n_max_it; }
+
+private:
+  void solve_range(const std::vector<double>& p, const double x0, std::size_t begin, std::size_t end) {
+    // the scalar solver reads the current parameter through the capture
+    double p_i = 0;
+    const auto fun = [this, &p_i](auto x) { return m_fun(x, p_i); };
+    if constexpr (std::is_same_v<DFun, AutoDiff>) {
+      BasicNewtonSolver<decltype(fun), AutoDiff> solver(fun, m_n_max_it, m_tol_fun, m_tol_x);
+      sweep(solver, p, p_i, x0, begin, end);
+    }
+    else {
+      const auto dfun = [this, &p_i](double x) { return m_dfun(x, p_i); };
+      BasicNewtonSolver<decltype(fun), decltype(dfun)> solver(fun, dfun, m_n_max_it, m_tol_fun, m_tol_x);
+      sweep(solver, p, p_i, x0, begin, end);
+    }
+  }
+
+  template<typename Solver>
+  void sweep(Solver& solver, const std::vector<double>& p, double& p_i, const double x0, std::size_t begin, std::size_t end) {
+    // number of previous converged solves usable for the prediction, at most 2
+    unsigned int known = 0;
+    double p1 = 0, x1 = 0, p2 = 0, x2 = 0;
+    for (auto i = begin; i < end; ++i) {
+      p_i = p[i];
+      double guess = x0;
+      if (m_predictor == Predictor::secant && known == 2 && p1 != p2)
+        guess = x1 + (x1 - x2) * (p_i - p1) / (p1 - p2);
+      else if (m_predictor != Predictor::none && known > 0)
+        guess = x1;
+      solver.solve(guess);
+      m_x[i] = solver.getResult();
+      m_res[i] = solver.getResidual();
+      m_iter[i] = solver.getIter();
+      if (converged(i)) {
+        p2 = p1;
+        x2 = x1;
+        p1 = p_i;
+        x1 = m_x[i];
+        known = std::min(known + 1, 2u);
+      }
+      else
+        known = 0;
+    }
+  }
+
+  Fun  m_fun;
+  DFun m_dfun;
+
+  const Predictor    m_predictor;
+  const unsigned int m_n_max_it;
+  const double       m_tol_fun;
+  const double       m_tol_x;
+  const unsigned int m_n_threads;
+
+  std::vector<double>       m_x;
+  std::vector<double>       m_res;
+  std::vector<unsigned int> m_iter;
+};
+
+template<typename Fun>
+NewtonSweep(const Fun&) -> NewtonSweep<Fun, AutoDiff>;
+template<typename Fun>
+NewtonSweep(const Fun&, Predictor, unsigned int = 0, double = 0, double = 0, unsigned int = 0) -> NewtonSweep<Fun, AutoDiff>;
+
+#endif /* NEWTON_SWEEP_H */
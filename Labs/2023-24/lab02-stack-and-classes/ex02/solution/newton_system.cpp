@@ -0,0 +1,64 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "newton_system.hpp"
+
+// sparse_matrix.hpp comes from lab03, its directory must be in the include path:
+//   g++ newton_system.cpp -std=c++20 -O3 -I ${mkEigenInc} -I ../../../lab03-stl-and-templates/ex01/step-4 -o newton_system
+// solves the discretization of -u'' + c u^3 = c on (0, 1) with u(0) = u(1) = 0,
+//   F_i(u) = (2 u_i - u_(i-1) - u_(i+1)) / h^2 + c u_i^3 - c,
+// with the three Jacobian strategies; the number of unknowns is given as first argument
+int main(int argc, char* argv[]) {
+  const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 100000;
+  const double h = 1.0 / (n + 1);
+  const double h2 = h * h;
+  // the weight of the nonlinear term, the bigger the more the Jacobian changes
+  const double c = 10.0;
+  // F is of the order of 1 / h^2, the error on u is about |F| / pi^2
+  const double tol = 1e-4;
+
+  const auto fun = [=](const std::vector<double>& u, std::vector<double>& f) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto left = i > 0 ? u[i - 1] : 0.0;
+      const auto right = i + 1 < n ? u[i + 1] : 0.0;
+      f[i] = (2 * u[i] - left - right) / h2 + c * u[i] * u[i] * u[i] - c;
+    }
+  };
+  const auto jac = [=](const std::vector<double>& u, SparseMatrix<double>& j) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (i > 0)
+        j(i, i - 1) = -1 / h2;
+      j(i, i) = 2 / h2 + 3 * c * u[i] * u[i];
+      if (i + 1 < n)
+        j(i, i + 1) = -1 / h2;
+    }
+  };
+
+  std::cout << std::setw(10) << "update" << std::setw(8) << "iter" << std::setw(16) << "factorizations"
+    << std::setw(8) << "solves" << std::setw(12) << "residuals" << std::setw(14) << "|F|" << std::setw(12)
+    << "time [ms]" << std::endl;
+  std::vector<double> reference;
+  for (const auto& [name, update] : { std::make_pair("newton", JacobianUpdate::newton),
+                                      std::make_pair("chord", JacobianUpdate::chord),
+                                      std::make_pair("broyden", JacobianUpdate::broyden) }) {
+    NewtonSystemSolver solver(fun, jac, update, 10, 0.5, 100, tol);
+    using namespace std::chrono;
+    const auto t0 = high_resolution_clock::now();
+    solver.solve(std::vector<double>(n, 0.0));
+    const auto t1 = high_resolution_clock::now();
+    std::cout << std::setw(10) << name << std::setw(8) << solver.getIter() << std::setw(16) << solver.getFactorizations()
+      << std::setw(8) << solver.getSolves() << std::setw(12) << solver.getResiduals()
+      << std::setw(14) << std::setprecision(3) << solver.getResidual()
+      << std::setw(12) << duration_cast<milliseconds>(t1 - t0).count() << std::endl;
+    if (reference.empty())
+      reference = solver.getResult();
+    double diff = 0;
+    for (std::size_t i = 0; i < n; ++i)
+      diff = std::max(diff, std::abs(solver.getResult()[i] - reference[i]));
+    std::cout << "same solution as Newton: " << (diff < tol ? "PASSED" : "FAILED") << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,215 @@
+#ifndef NEWTON_SYSTEM_H
+#define NEWTON_SYSTEM_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Eigen>
+
+// from lab03-stl-and-templates/ex01/step-4, see newton_system.cpp for the include path
+#include "sparse_matrix.hpp"
+
+// how the Jacobian is used between two assemblies
+enum class JacobianUpdate {
+  newton,  // assembled and factorized at every iteration
+  chord,   // the factorization is reused for the next steps
+  broyden  // the factorization is reused and corrected with Broyden's rank one updates
+};
+
+// Newton's method for a nonlinear system F(x) = 0 with a sparse Jacobian.
+// The Jacobian is assembled by the user into a SparseMatrix and factorized with
+// Eigen's SparseLU. With chord and Broyden iterations the factorization is kept for
+// up to max_reuse steps, and rebuilt earlier if the residual decreases by less
+// than a factor reuse_ratio in a step. Broyden's method applies to the old
+// factorization the rank one corrections
+//   H_(j+1) = (I + p_j s_j^T) H_j,  p_j = (s_j - H_j y_j) / (s_j^T H_j y_j)
+// where s_j is the step and y_j the change of the residual, so that
+// H_(j+1) y_j = s_j; H_j v costs one solve plus one dot product per update.
+// The symbolic analysis of SparseLU is redone only when the pattern of the assembled
+// Jacobian changes, e.g. if the user leaves out entries that happen to be zero.
+class NewtonSystemSolver {
+public:
+  using Vector = SparseMatrix<double>::Vector;
+  using Residual = std::function<void(const Vector&, Vector&)>;
+  using Jacobian = std::function<void(const Vector&, SparseMatrix<double>&)>;
+
+  NewtonSystemSolver(
+    const Residual& fun_,
+    const Jacobian& jac_,
+    const JacobianUpdate update_ = JacobianUpdate::newton,
+    const unsigned int max_reuse_ = 10,
+    const double reuse_ratio_ = 0.5,
+    const unsigned int n_max_it_ = 100,
+    const double tol_fun_ = 1e-10,
+    const double tol_x_ = 1e-14
+  )
+    :
+    m_fun(fun_),
+    m_jac(jac_),
+    m_update(update_),
+    m_max_reuse(max_reuse_),
+    m_reuse_ratio(reuse_ratio_),
+    m_n_max_it(n_max_it_),
+    m_tol_fun(tol_fun_),
+    m_tol_x(tol_x_) {
+  }
+
+  void solve(const Vector& x0) {
+    const auto n = x0.size();
+    m_x = x0;
+    m_f.resize(n);
+    m_f_new.resize(n);
+    m_dx.resize(n);
+    m_s.clear();
+    m_p.clear();
+    m_n_factorizations = m_n_solves = m_n_residuals = 0;
+
+    evaluate(m_x, m_f);
+    m_res = norm(m_f);
+    unsigned int age = 0;
+    bool refresh = true;
+    for (m_iter = 0; m_iter < m_n_max_it && m_res >= m_tol_fun; ++m_iter) {
+      if (refresh || m_update == JacobianUpdate::newton || age >= m_max_reuse) {
+        factorize(m_x);
+        age = 0;
+        refresh = false;
+      }
+      // dx = -H F
+      apply_inverse(m_f, m_dx);
+      for (auto& v : m_dx)
+        v = -v;
+      for (std::size_t i = 0; i < n; ++i)
+        m_x[i] += m_dx[i];
+      evaluate(m_x, m_f_new);
+      const auto res_new = norm(m_f_new);
+
+      if (m_update == JacobianUpdate::broyden) {
+        // y = F_new - F, z = H y
+        Vector y(n), z(n);
+        for (std::size_t i = 0; i < n; ++i)
+          y[i] = m_f_new[i] - m_f[i];
+        apply_inverse(y, z);
+        const auto sz = dot(m_dx, z);
+        if (sz != 0) {
+          for (std::size_t i = 0; i < n; ++i)
+            z[i] = (m_dx[i] - z[i]) / sz;
+          m_s.push_back(m_dx);
+          m_p.push_back(std::move(z));
+        }
+      }
+      // a slow decrease means that the Jacobian is too old
+      refresh = res_new > m_reuse_ratio * m_res;
+      ++age;
+      std::swap(m_f, m_f_new);
+      m_res = res_new;
+      if (norm(m_dx) < m_tol_x) {
+        ++m_iter;
+        break;
+      }
+    }
+  }
+
+  const Vector& getResult() const { return m_x; }
+  const Vector& getStep() const { return m_dx; }
+  double getResidual() const { return m_res; }
+  unsigned int getIter() const { return m_iter; }
+  unsigned int getFactorizations() const { return m_n_factorizations; }
+  unsigned int getSolves() const { return m_n_solves; }
+  unsigned int getResiduals() const { return m_n_residuals; }
+
+private:
+  static double norm(const Vector& v) {
+    double r = 0;
+    for (const auto x : v)
+      r = std::max(r, std::abs(x));
+    return r;
+  }
+
+  static double dot(const Vector& a, const Vector& b) {
+    return std::inner_product(a.begin(), a.end(), b.begin(), 0.0);
+  }
+
+  void evaluate(const Vector& x, Vector& f) {
+    m_fun(x, f);
+    ++m_n_residuals;
+  }
+
+  // assembles the Jacobian in x, converts it to Eigen and factorizes it
+  void factorize(const Vector& x) {
+    MapMatrix<double> jac;
+    m_jac(x, jac);
+    const auto n = x.size();
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(jac.nnz());
+    const auto& rows = jac.rows();
+    for (std::size_t i = 0; i < rows.size(); ++i)
+      for (const auto& [j, v] : rows[i])
+        triplets.emplace_back(i, j, v);
+    m_jacobian.resize(n, n);
+    m_jacobian.setFromTriplets(triplets.begin(), triplets.end());
+    // the symbolic analysis depends only on the pattern, it is reused while it does not change
+    if (!same_pattern()) {
+      m_lu.analyzePattern(m_jacobian);
+      m_outer.assign(m_jacobian.outerIndexPtr(), m_jacobian.outerIndexPtr() + m_jacobian.outerSize() + 1);
+      m_inner.assign(m_jacobian.innerIndexPtr(), m_jacobian.innerIndexPtr() + m_jacobian.nonZeros());
+    }
+    m_lu.factorize(m_jacobian);
+    if (m_lu.info() != Eigen::Success)
+      throw std::runtime_error("NewtonSystemSolver: singular Jacobian");
+    ++m_n_factorizations;
+    m_s.clear();
+    m_p.clear();
+  }
+
+  // whether m_jacobian has the pattern of the last analyzed one (it is compressed)
+  bool same_pattern() const {
+    const auto nnz = static_cast<std::size_t>(m_jacobian.nonZeros());
+    return m_outer.size() == static_cast<std::size_t>(m_jacobian.outerSize()) + 1 && m_inner.size() == nnz &&
+      std::equal(m_outer.begin(), m_outer.end(), m_jacobian.outerIndexPtr()) &&
+      std::equal(m_inner.begin(), m_inner.end(), m_jacobian.innerIndexPtr());
+  }
+
+  // out = H v: a solve with the factorization and then the Broyden updates
+  void apply_inverse(const Vector& v, Vector& out) {
+    const auto n = static_cast<Eigen::Index>(v.size());
+    Eigen::Map<Eigen::VectorXd>(out.data(), n) = m_lu.solve(Eigen::Map<const Eigen::VectorXd>(v.data(), n));
+    ++m_n_solves;
+    for (std::size_t j = 0; j < m_s.size(); ++j) {
+      const auto c = dot(m_s[j], out);
+      for (std::size_t i = 0; i < out.size(); ++i)
+        out[i] += m_p[j][i] * c;
+    }
+  }
+
+  Residual m_fun;
+  Jacobian m_jac;
+
+  const JacobianUpdate m_update;
+  const unsigned int   m_max_reuse;
+  const double         m_reuse_ratio;
+  const unsigned int   m_n_max_it;
+  const double         m_tol_fun;
+  const double         m_tol_x;
+
+  Vector       m_x, m_f, m_f_new, m_dx;
+  double       m_res = 0;
+  unsigned int m_iter = 0;
+
+  Eigen::SparseMatrix<double> m_jacobian;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> m_lu;
+  // the pattern m_lu was analyzed with, empty before the first factorization
+  std::vector<Eigen::Index> m_outer, m_inner;
+  // steps and corrections of the Broyden updates since the last factorization
+  std::vector<Vector> m_s, m_p;
+
+  unsigned int m_n_factorizations = 0;
+  unsigned int m_n_solves = 0;
+  unsigned int m_n_residuals = 0;
+};
+
+#endif /* NEWTON_SYSTEM_H */
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <functional>
+
+#include <Eigen/Eigen>
+
+#include "sparse_matrix.hpp"
+#include "matrix_pow.hpp"
+
+using Dense = MatrixPower<double>::Dense;
+using EigenSparse = MatrixPower<double>::EigenSparse;
+
+// the scalar squaring loop written for matrices, every product is a new temporary
+Dense pow_naive(Dense base, unsigned int exp) {
+  Dense res = Dense::Identity(base.rows(), base.cols());
+  while (exp > 0) {
+    if (exp & 1)
+      res = res * base;
+    base = base * base;
+    exp >>= 1;
+  }
+  return res;
+}
+
+// random row stochastic matrix with n_per_row entries in each row plus the diagonal
+MapMatrix<double> transition_matrix(size_t n, size_t n_per_row) {
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<size_t> column(0, n - 1);
+  std::uniform_real_distribution<double> weight(0.1, 1.0);
+  MapMatrix<double> p;
+  for (size_t i = 0; i < n; ++i) {
+    std::vector<std::pair<size_t, double>> row{ { i, weight(engine) } };
+    for (size_t k = 0; k < n_per_row; ++k)
+      row.emplace_back(column(engine), weight(engine));
+    double sum = 0;
+    for (const auto& [j, w] : row)
+      sum += w;
+    for (const auto& [j, w] : row)
+      p(i, j) += w / sum;
+  }
+  return p;
+}
+
+EigenSparse to_eigen(const MapMatrix<double>& m) {
+  EigenSparse res(m.nrows(), m.ncols());
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (size_t i = 0; i < m.rows().size(); ++i)
+    for (const auto& [j, v] : m.rows()[i])
+      triplets.emplace_back(i, j, v);
+  res.setFromTriplets(triplets.begin(), triplets.end());
+  return res;
+}
+
+// utility for printing the result of a test
+void print_test_result(bool r, const std::string& test_name) {
+  std::cout << test_name << " test: " << (r ? "PASSED" : "FAILED") << std::endl;
+}
+
+double timeit(const std::function<void()>& f) {
+  using namespace std::chrono;
+  const auto t0 = high_resolution_clock::now();
+  f();
+  const auto t1 = high_resolution_clock::now();
+  return duration_cast<microseconds>(t1 - t0).count() / 1000.0;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t n = argc > 1 ? std::stoul(argv[1]) : 400;
+  constexpr double toll = 1e-10;
+
+  MatrixPower<double> power;
+  {
+    std::cout << "-- tests -----------------" << std::endl;
+    const auto p = transition_matrix(50, 2);
+    const auto p_eigen = to_eigen(p);
+    const Dense p_dense(p_eigen);
+    for (unsigned int exp : { 0u, 1u, 2u, 7u, 64u, 1000u }) {
+      const auto expected = pow_naive(p_dense, exp);
+      Dense res_dense;
+      EigenSparse res_sparse;
+      MapMatrix<double> res_map;
+      power(p_dense, exp, res_dense);
+      power(p_eigen, exp, res_sparse);
+      power(p, exp, res_map);
+      const Dense map_dense(to_eigen(res_map));
+      const auto name = "A^" + std::to_string(exp);
+      print_test_result((res_dense - expected).norm() < toll, name + " dense");
+      print_test_result((Dense(res_sparse) - expected).norm() < toll, name + " eigen sparse");
+      print_test_result((map_dense - expected).norm() < toll, name + " map matrix");
+    }
+  }
+
+  std::cout << "-- benchmark, n = " << n << " -----------------" << std::endl;
+  std::cout << "exp\tnaive [ms]\tdense [ms]\tsparse [ms]\tnnz\tdense switch" << std::endl;
+  const auto p = transition_matrix(n, 2);
+  const auto p_eigen = to_eigen(p);
+  const Dense p_dense(p_eigen);
+  Dense res_dense;
+  EigenSparse res_sparse;
+  for (unsigned int exp : { 2u, 4u, 8u, 16u, 1000u, 100000u }) {
+    Dense res_naive;
+    const auto dt_naive = timeit([&]() { res_naive = pow_naive(p_dense, exp); });
+    const auto dt_dense = timeit([&]() { power(p_dense, exp, res_dense); });
+    const auto dt_sparse = timeit([&]() { power(p_eigen, exp, res_sparse); });
+    std::cout << exp << "\t" << dt_naive << "\t\t" << dt_dense << "\t\t" << dt_sparse
+      << "\t\t" << res_sparse.nonZeros() << "\t" << (power.went_dense() ? "yes" : "no") << std::endl;
+  }
+  // the rows of a power of a transition matrix still sum to one
+  print_test_result(((res_dense.rowwise().sum().array() - 1).abs() < toll).all(), "stochastic");
+  return 0;
+}
@@ -0,0 +1,242 @@
+#ifndef MATRIX_POW_H
+#define MATRIX_POW_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
+#include <Eigen/Eigen>
+
+#include "sparse_matrix.hpp"
+
+// A^exp by repeated squaring for square matrices. The scalar version
+//   T res = 1; while (exp) { if (exp & 1) res *= base; base *= base; exp >>= 1; }
+// does not work for matrices (there is no T res = 1) and allocates a new
+// temporary for every product. Here the products are written into work buffers
+// owned by the object and the buffers are swapped, so calling it again on matrices
+// of the same size does not allocate. The first factor is copied instead of
+// multiplied by the identity and the last useless squaring is skipped.
+// Sparse inputs are multiplied in CSR format until the fill-in makes the next
+// product cheaper as a dense one, then the computation continues dense.
+template<typename T>
+class MatrixPower {
+public:
+  using Dense = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+  using EigenSparse = Eigen::SparseMatrix<T, Eigen::RowMajor>;
+
+  // a sparse product becomes dense when its number of multiply-adds, times this
+  // factor, is bigger than the n^3 of the dense product (measured with matrix_pow.cpp)
+  explicit MatrixPower(double sparse_flop_cost = 16) : m_sparse_flop_cost(sparse_flop_cost) {}
+
+  void operator()(const Dense& a, unsigned int exp, Dense& res) {
+    assert(a.rows() == a.cols());
+    if (exp == 0) {
+      res.setIdentity(a.rows(), a.cols());
+      return;
+    }
+    m_base = a;
+    pow_dense(exp, res, false);
+  }
+
+  void operator()(const EigenSparse& a, unsigned int exp, EigenSparse& res) {
+    assert(a.rows() == a.cols());
+    m_base_csr.n = a.rows();
+    m_base_csr.row_ptr.assign(1, 0);
+    m_base_csr.col.clear();
+    m_base_csr.val.clear();
+    for (index_t i = 0; i < m_base_csr.n; ++i) {
+      for (typename EigenSparse::InnerIterator it(a, i); it; ++it) {
+        m_base_csr.col.push_back(it.col());
+        m_base_csr.val.push_back(it.value());
+      }
+      m_base_csr.row_ptr.push_back(m_base_csr.col.size());
+    }
+    if (pow_sparse(exp)) {
+      res = m_res.sparseView();
+    }
+    else {
+      res = Eigen::Map<const EigenSparse>(m_res_csr.n, m_res_csr.n, m_res_csr.col.size(),
+        m_res_csr.row_ptr.data(), m_res_csr.col.data(), m_res_csr.val.data());
+    }
+  }
+
+  void operator()(const MapMatrix<T>& a, unsigned int exp, MapMatrix<T>& res) {
+    assert(a.nrows() == a.ncols());
+    const auto& rows = a.rows();
+    m_base_csr.n = a.nrows();
+    m_base_csr.row_ptr.assign(1, 0);
+    m_base_csr.col.clear();
+    m_base_csr.val.clear();
+    for (index_t i = 0; i < m_base_csr.n; ++i) {
+      if (static_cast<size_t>(i) < rows.size())
+        for (const auto& [j, v] : rows[i]) {
+          m_base_csr.col.push_back(j);
+          m_base_csr.val.push_back(v);
+        }
+      m_base_csr.row_ptr.push_back(m_base_csr.col.size());
+    }
+    res = MapMatrix<T>();
+    if (pow_sparse(exp)) {
+      for (index_t i = 0; i < m_res.rows(); ++i)
+        for (index_t j = 0; j < m_res.cols(); ++j)
+          if (m_res(i, j) != T(0))
+            res(i, j) = m_res(i, j);
+    }
+    else {
+      for (index_t i = 0; i < m_res_csr.n; ++i)
+        for (auto k = m_res_csr.row_ptr[i]; k < m_res_csr.row_ptr[i + 1]; ++k)
+          res(i, m_res_csr.col[k]) = m_res_csr.val[k];
+    }
+  }
+
+  // whether the last sparse computation switched to dense
+  bool went_dense() const { return m_went_dense; }
+
+private:
+  using index_t = typename EigenSparse::StorageIndex;
+
+  // compressed sparse rows, the columns of each row are sorted
+  struct Csr {
+    index_t n = 0;
+    std::vector<index_t> row_ptr, col;
+    std::vector<T> val;
+
+    void set_identity(index_t size) {
+      n = size;
+      row_ptr.resize(n + 1);
+      col.resize(n);
+      val.assign(n, T(1));
+      for (index_t i = 0; i <= n; ++i)
+        row_ptr[i] = i;
+      std::copy(row_ptr.begin(), row_ptr.end() - 1, col.begin());
+    }
+
+    void to_dense(Dense& d) const {
+      d.setZero(n, n);
+      for (index_t i = 0; i < n; ++i)
+        for (auto k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+          d(i, col[k]) = val[k];
+    }
+  };
+
+  // number of multiply-adds of the product a * b
+  static double flops(const Csr& a, const Csr& b) {
+    double count = 0;
+    for (auto j : a.col)
+      count += b.row_ptr[j + 1] - b.row_ptr[j];
+    return count;
+  }
+
+  // c = a * b with Gustavson's algorithm: row i of c accumulates the rows of b
+  // scaled by the entries of row i of a into a dense accumulator
+  void multiply(const Csr& a, const Csr& b, Csr& c) {
+    const auto n = a.n;
+    c.n = n;
+    c.row_ptr.resize(n + 1);
+    c.col.clear();
+    c.val.clear();
+    m_acc.resize(n);
+    m_marker.assign(n, -1);
+    c.row_ptr[0] = 0;
+    for (index_t i = 0; i < n; ++i) {
+      const auto start = c.col.size();
+      for (auto ka = a.row_ptr[i]; ka < a.row_ptr[i + 1]; ++ka) {
+        const auto k = a.col[ka];
+        const auto aik = a.val[ka];
+        for (auto kb = b.row_ptr[k]; kb < b.row_ptr[k + 1]; ++kb) {
+          const auto j = b.col[kb];
+          if (m_marker[j] != i) {
+            m_marker[j] = i;
+            m_acc[j] = aik * b.val[kb];
+            c.col.push_back(j);
+          }
+          else {
+            m_acc[j] += aik * b.val[kb];
+          }
+        }
+      }
+      std::sort(c.col.begin() + start, c.col.end());
+      for (auto k = start; k < c.col.size(); ++k)
+        c.val.push_back(m_acc[c.col[k]]);
+      c.row_ptr[i + 1] = c.col.size();
+    }
+  }
+
+  // continues the squaring loop on m_base (and on res if have_res) with dense products
+  void pow_dense(unsigned int exp, Dense& res, bool have_res) {
+    while (true) {
+      if (exp & 1) {
+        if (have_res) {
+          m_tmp.noalias() = res * m_base;
+          res.swap(m_tmp);
+        }
+        else {
+          res = m_base;
+          have_res = true;
+        }
+      }
+      exp >>= 1;
+      if (exp == 0)
+        break;
+      m_tmp.noalias() = m_base * m_base;
+      m_base.swap(m_tmp);
+    }
+  }
+
+  // m_base_csr^exp into m_res_csr, returns true if it switched to dense and the
+  // result is in m_res instead
+  bool pow_sparse(unsigned int exp) {
+    m_went_dense = false;
+    const double dense_flops = double(m_base_csr.n) * m_base_csr.n * m_base_csr.n;
+    const auto too_dense = [&](const Csr& a, const Csr& b) {
+      return m_sparse_flop_cost * flops(a, b) > dense_flops;
+    };
+    if (exp == 0) {
+      m_res_csr.set_identity(m_base_csr.n);
+      return false;
+    }
+    bool have_res = false;
+    while (true) {
+      if (exp & 1) {
+        if (have_res) {
+          if (too_dense(m_res_csr, m_base_csr))
+            break;
+          multiply(m_res_csr, m_base_csr, m_tmp_csr);
+          std::swap(m_res_csr, m_tmp_csr);
+        }
+        else {
+          m_res_csr = m_base_csr;
+          have_res = true;
+        }
+      }
+      exp >>= 1;
+      if (exp == 0)
+        return false;
+      if (too_dense(m_base_csr, m_base_csr)) {
+        // the base has not been squared: undo the shift, the lowest bit is now 0
+        // because its factor is already in the result
+        exp <<= 1;
+        break;
+      }
+      multiply(m_base_csr, m_base_csr, m_tmp_csr);
+      std::swap(m_base_csr, m_tmp_csr);
+    }
+    // the lowest bit of exp refers to m_base, as at the top of the loop
+    m_went_dense = true;
+    m_base_csr.to_dense(m_base);
+    if (have_res)
+      m_res_csr.to_dense(m_res);
+    pow_dense(exp, m_res, have_res);
+    return true;
+  }
+
+  double m_sparse_flop_cost;
+  bool m_went_dense = false;
+  Dense m_base, m_tmp, m_res;
+  Csr m_base_csr, m_tmp_csr, m_res_csr;
+  std::vector<T> m_acc;
+  std::vector<index_t> m_marker;
+};
+
+#endif /* MATRIX_POW_H */